@@ -0,0 +1,224 @@
+// BarnesHutTree.cpp
+#include "BarnesHutTree.h"
+#include <cmath>
+#include <algorithm>
+
+namespace {
+    // Bodies that share (almost) the same position stop subdividing at this depth
+    // and are kept together in one leaf instead.
+    constexpr int MAX_DEPTH = 24;
+}
+
+BarnesHutTree::BarnesHutTree()
+{
+}
+
+void BarnesHutTree::clear()
+{
+    // Keep capacity so rebuilding every tick does not reallocate
+    a.clear();
+    b.clear();
+    c.clear();
+    d.clear();
+    e.clear();
+    f.clear();
+    g.clear();
+}
+
+void BarnesHutTree::addBody(sf::Vector2f pos, float mass, float radius, int id)
+{
+    b.push_back(pos.x);
+    c.push_back(pos.y);
+    d.push_back(mass);
+    e.push_back(radius);
+    f.push_back(id);
+    g.push_back(-1);
+}
+
+int BarnesHutTree::createNode(float centerX, float centerY, float halfSize)
+{
+    Node a;
+    a.a = centerX;
+    a.b = centerY;
+    a.c = halfSize;
+    a.d = 0.0f;
+    a.e = centerX;
+    a.f = centerY;
+    a.g = -1;
+    a.h = -1;
+    this->a.push_back(a);
+    return static_cast<int>(this->a.size()) - 1;
+}
+
+int BarnesHutTree::childFor(const Node& node, float x, float y) const
+{
+    // Children are stored as: 0 = top-left, 1 = top-right, 2 = bottom-left, 3 = bottom-right
+    int a = (x >= node.a) ? 1 : 0;
+    int b = (y >= node.b) ? 2 : 0;
+    return a + b;
+}
+
+void BarnesHutTree::subdivide(int node)
+{
+    // Copy the values first - createNode may reallocate the node vector
+    float a = this->a[node].a;
+    float b = this->a[node].b;
+    float c = this->a[node].c * 0.5f;
+
+    int d = createNode(a - c, b - c, c);
+    createNode(a + c, b - c, c);
+    createNode(a - c, b + c, c);
+    createNode(a + c, b + c, c);
+
+    this->a[node].g = d;
+}
+
+void BarnesHutTree::insert(int body)
+{
+    int a = 0; // current node
+    int b = 0; // depth
+
+    while (true) {
+        if (this->a[a].g != -1) {
+            // Internal node - descend into the matching quadrant
+            a = this->a[a].g + childFor(this->a[a], this->b[body], this->c[body]);
+            b++;
+            continue;
+        }
+
+        if (this->a[a].h == -1 || b >= MAX_DEPTH) {
+            // Empty leaf (or depth limit reached) - link the body into this leaf
+            g[body] = this->a[a].h;
+            this->a[a].h = body;
+            return;
+        }
+
+        // Occupied leaf - split it and push the bodies it held one level down
+        subdivide(a);
+        int c = this->a[a].h;
+        this->a[a].h = -1;
+        while (c != -1) {
+            int d = g[c];
+            int e = this->a[a].g + childFor(this->a[a], this->b[c], this->c[c]);
+            g[c] = this->a[e].h;
+            this->a[e].h = c;
+            c = d;
+        }
+        // Loop again - the node is now internal and the new body descends further
+    }
+}
+
+void BarnesHutTree::build()
+{
+    a.clear();
+    if (b.empty()) return;
+
+    // Square bounding box around all bodies
+    float minX = b[0], maxX = b[0];
+    float minY = c[0], maxY = c[0];
+    for (size_t i = 1; i < b.size(); i++) {
+        minX = std::min(minX, b[i]);
+        maxX = std::max(maxX, b[i]);
+        minY = std::min(minY, c[i]);
+        maxY = std::max(maxY, c[i]);
+    }
+    float halfSize = std::max(maxX - minX, maxY - minY) * 0.5f + 1.0f;
+
+    a.reserve(b.size() * 2);
+    createNode((minX + maxX) * 0.5f, (minY + maxY) * 0.5f, halfSize);
+
+    for (size_t i = 0; i < b.size(); i++) {
+        g[i] = -1;
+        insert(static_cast<int>(i));
+    }
+
+    // Children are always created after their parent, so walking the nodes
+    // backwards visits every child before the node that contains it
+    for (size_t i = a.size(); i-- > 0; ) {
+        Node& n = a[i];
+        float mass = 0.0f;
+        float sumX = 0.0f;
+        float sumY = 0.0f;
+
+        if (n.g == -1) {
+            for (int j = n.h; j != -1; j = g[j]) {
+                mass += d[j];
+                sumX += d[j] * b[j];
+                sumY += d[j] * c[j];
+            }
+        }
+        else {
+            for (int j = 0; j < 4; j++) {
+                const Node& child = a[n.g + j];
+                mass += child.d;
+                sumX += child.d * child.e;
+                sumY += child.d * child.f;
+            }
+        }
+
+        n.d = mass;
+        if (mass > 0.0f) {
+            n.e = sumX / mass;
+            n.f = sumY / mass;
+        }
+    }
+}
+
+sf::Vector2f BarnesHutTree::accelerationAt(sf::Vector2f pos, float radius, int selfId, float G, float theta) const
+{
+    sf::Vector2f acceleration(0.0f, 0.0f);
+    if (a.empty()) return acceleration;
+
+    const float thetaSquared = theta * theta;
+
+    // Depth-first walk with a local stack so concurrent queries do not share state.
+    // Every level leaves at most 3 siblings behind, so this can never overflow.
+    int h[4 * (MAX_DEPTH + 1)];
+    int count = 0;
+    h[count++] = 0;
+
+    while (count > 0) {
+        const Node& n = a[h[--count]];
+
+        if (n.d <= 0.0f) continue;
+
+        if (n.g == -1) {
+            // Leaf - exact interaction with every body it holds
+            for (int j = n.h; j != -1; j = g[j]) {
+                if (f[j] == selfId) continue;
+
+                float dx = b[j] - pos.x;
+                float dy = c[j] - pos.y;
+                float dist = std::sqrt(dx * dx + dy * dy);
+
+                // Same contact rule as the exact O(n^2) path
+                if (dist > e[j] + radius) {
+                    float k = G * d[j] / (dist * dist * dist);
+                    acceleration.x += dx * k;
+                    acceleration.y += dy * k;
+                }
+            }
+            continue;
+        }
+
+        float dx = n.e - pos.x;
+        float dy = n.f - pos.y;
+        float distSquared = dx * dx + dy * dy;
+        float size = n.c * 2.0f;
+
+        if (size * size < thetaSquared * distSquared) {
+            // Far enough away - treat the whole cell as one point mass
+            float dist = std::sqrt(distSquared);
+            float k = G * n.d / (distSquared * dist);
+            acceleration.x += dx * k;
+            acceleration.y += dy * k;
+        }
+        else {
+            for (int j = 0; j < 4; j++) {
+                h[count++] = n.g + j;
+            }
+        }
+    }
+
+    return acceleration;
+}
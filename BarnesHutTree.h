@@ -0,0 +1,50 @@
+// BarnesHutTree.h
+#pragma once
+#include <SFML/System/Vector2.hpp>
+#include <vector>
+#include <cstddef>
+
+// Quadtree used by GravitySimulator to approximate far-field gravity.
+// Bodies are added with addBody(), then build() creates the tree. A cluster of
+// bodies is treated as one point mass when (cellSize / distance) < theta.
+class BarnesHutTree {
+private:
+    struct Node {
+        float a; // centerX
+        float b; // centerY
+        float c; // halfSize
+        float d; // mass
+        float e; // centerOfMassX
+        float f; // centerOfMassY
+        int g; // firstChild - index of the first of 4 children, -1 for a leaf
+        int h; // firstBody - head of the body list for a leaf, -1 if empty
+    };
+
+    std::vector<Node> a; // nodes
+    std::vector<float> b; // bodyX
+    std::vector<float> c; // bodyY
+    std::vector<float> d; // bodyMass
+    std::vector<float> e; // bodyRadius
+    std::vector<int> f; // bodyId - caller supplied id, used to skip self interaction
+    std::vector<int> g; // nextBody - linked list of bodies inside a leaf
+
+    int createNode(float centerX, float centerY, float halfSize);
+    void insert(int body);
+    void subdivide(int node);
+    int childFor(const Node& node, float x, float y) const;
+
+public:
+    BarnesHutTree();
+
+    void clear();
+    void addBody(sf::Vector2f pos, float mass, float radius, int id);
+    void build();
+
+    bool empty() const { return b.empty(); }
+    size_t getBodyCount() const { return b.size(); }
+
+    // Gravitational acceleration at pos. Bodies with the given selfId are skipped,
+    // and (like the exact path) a body only pulls when distance > its radius + radius.
+    // Read-only on the tree, so several threads may query it at once.
+    sf::Vector2f accelerationAt(sf::Vector2f pos, float radius, int selfId, float G, float theta) const;
+};
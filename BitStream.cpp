@@ -0,0 +1,124 @@
+// BitStream.cpp
+#include "BitStream.h"
+#include <cstring>
+
+BitWriter::BitWriter() : b(0), c(0)
+{
+}
+
+void BitWriter::clear()
+{
+    a.clear();
+    b = 0;
+    c = 0;
+}
+
+void BitWriter::write(uint32_t value, int bits)
+{
+    if (bits < 32) value &= (1u << bits) - 1u;
+    b |= static_cast<uint64_t>(value) << c;
+    c += bits;
+
+    while (c >= 8) {
+        a.push_back(static_cast<uint8_t>(b & 0xFF));
+        b >>= 8;
+        c -= 8;
+    }
+}
+
+void BitWriter::writeSigned(int32_t value, int bits)
+{
+    // Two's complement truncated to the field width
+    write(static_cast<uint32_t>(value), bits);
+}
+
+void BitWriter::writeFloat(float value)
+{
+    uint32_t d;
+    std::memcpy(&d, &value, sizeof(d));
+    write(d, 32);
+}
+
+void BitWriter::writeTo(sf::Packet& packet)
+{
+    // Flush the partial byte - the unused high bits are zero
+    if (c > 0) {
+        a.push_back(static_cast<uint8_t>(b & 0xFF));
+        b = 0;
+        c = 0;
+    }
+
+    packet << static_cast<uint32_t>(a.size());
+    if (!a.empty()) {
+        packet.append(a.data(), a.size());
+    }
+}
+
+BitReader::BitReader() : b(0), c(false)
+{
+}
+
+bool BitReader::readFrom(sf::Packet& packet)
+{
+    a.clear();
+    b = 0;
+    c = false;
+
+    uint32_t d;
+    if (!(packet >> d)) {
+        c = true;
+        return false;
+    }
+
+    // Never trust the count further than the packet goes
+    if (d > packet.getDataSize() - packet.getReadPosition()) {
+        c = true;
+        return false;
+    }
+
+    a.resize(d);
+    for (uint32_t e = 0; e < d; e++) {
+        packet >> a[e];
+    }
+    return static_cast<bool>(packet);
+}
+
+uint32_t BitReader::read(int bits)
+{
+    if (b + bits > a.size() * 8) {
+        c = true;
+        return 0;
+    }
+
+    uint32_t d = 0;
+    for (int e = 0; e < bits; ) {
+        size_t f = b >> 3; // byte
+        int g = static_cast<int>(b & 7); // bit within the byte
+        int h = 8 - g; // bits left in the byte
+        if (h > bits - e) h = bits - e;
+
+        uint32_t i = (a[f] >> g) & ((1u << h) - 1u);
+        d |= i << e;
+        e += h;
+        b += h;
+    }
+    return d;
+}
+
+int32_t BitReader::readSigned(int bits)
+{
+    uint32_t d = read(bits);
+    // Sign-extend from the field width
+    if (bits < 32 && (d & (1u << (bits - 1)))) {
+        d |= ~((1u << bits) - 1u);
+    }
+    return static_cast<int32_t>(d);
+}
+
+float BitReader::readFloat()
+{
+    uint32_t d = read(32);
+    float e;
+    std::memcpy(&e, &d, sizeof(e));
+    return e;
+}
@@ -0,0 +1,49 @@
+// BitStream.h
+#pragma once
+#include <SFML/Network.hpp>
+#include <vector>
+#include <cstdint>
+
+// Bit-level writer for compact packet payloads. Values are written LSB first
+// with exactly the requested number of bits; writeTo() appends the bytes to an
+// sf::Packet behind a byte count, so bit-packed sections can sit next to
+// ordinary packet fields.
+class BitWriter {
+private:
+    std::vector<uint8_t> a; // bytes
+    uint64_t b; // scratch - bits not yet flushed to a
+    int c; // scratchBits
+
+public:
+    BitWriter();
+
+    void clear();
+    void write(uint32_t value, int bits);
+    void writeSigned(int32_t value, int bits);
+    void writeBool(bool value) { write(value ? 1u : 0u, 1); }
+    void writeFloat(float value);
+
+    void writeTo(sf::Packet& packet);
+};
+
+// Reads what BitWriter wrote. Reading past the end returns zeros and marks
+// the reader as failed instead of throwing.
+class BitReader {
+private:
+    std::vector<uint8_t> a; // bytes
+    size_t b; // bitPosition
+    bool c; // failed
+
+public:
+    BitReader();
+
+    // Takes the next bit-packed section out of the packet
+    bool readFrom(sf::Packet& packet);
+
+    uint32_t read(int bits);
+    int32_t readSigned(int bits);
+    bool readBool() { return read(1) != 0; }
+    float readFloat();
+
+    bool hasFailed() const { return c; }
+};
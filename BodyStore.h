@@ -0,0 +1,37 @@
+// BodyStore.h
+#pragma once
+#include <vector>
+#include <cstddef>
+
+// Structure-of-arrays copy of the planet state owned by GravitySimulator.
+// The force kernels stream through these arrays instead of chasing Planet*
+// (which also drag their sf::CircleShape through the cache). Index i matches
+// the planet at index i of the simulator's planet list.
+struct BodyStore {
+    std::vector<float> a; // positionX
+    std::vector<float> b; // positionY
+    std::vector<float> c; // velocityX
+    std::vector<float> d; // velocityY
+    std::vector<float> e; // mass
+    std::vector<float> f; // radius
+    std::vector<int> g; // ownerId
+    std::vector<float> h; // accelerationX
+    std::vector<float> i; // accelerationY
+    std::vector<unsigned char> j; // simulated - cached shouldSimulateObject() result
+
+    // Vectors keep their capacity, so resizing to the same count every tick is free
+    void resize(size_t count) {
+        a.resize(count);
+        b.resize(count);
+        c.resize(count);
+        d.resize(count);
+        e.resize(count);
+        f.resize(count);
+        g.resize(count);
+        h.resize(count);
+        i.resize(count);
+        j.resize(count);
+    }
+
+    size_t size() const { return a.size(); }
+};
@@ -1,37 +1,44 @@
-// Car.h
-#pragma once
-#include "GameObject.h"
-#include "Planet.h"
-#include <vector>
-
-class Rocket; // Forward declaration
-
-class Car : public GameObject {
-private:
-    sf::RectangleShape body;
-    sf::CircleShape wheels[2];
-    sf::ConvexShape directionArrow;
-    float rotation;
-    float speed;
-    float maxSpeed;
-    Planet* currentPlanet;
-    bool isGrounded;
-    bool isFacingRight;  // New variable to track car direction
-
-public:
-    Car(sf::Vector2f pos, sf::Vector2f vel, sf::Color col = sf::Color::Green);
-
-    void accelerate(float amount);
-    void rotate(float amount);
-    bool isOnGround() const { return isGrounded; }
-    void checkGrounding(const std::vector<Planet*>& planets);
-
-    void update(float deltaTime) override;
-    void draw(sf::RenderWindow& window) override;
-    void drawWithConstantSize(sf::RenderWindow& window, float zoomLevel);
-
-    // Transfer state from rocket
-    void initializeFromRocket(const Rocket* rocket);
-    float getRotation() const { return rotation; }
-    bool getIsFacingRight() const { return isFacingRight; }
+// Car.h
+#pragma once
+#include "GameObject.h"
+#include "Planet.h"
+#include <vector>
+
+class Rocket; // Forward declaration
+
+class Car : public GameObject {
+private:
+#ifndef HEADLESS_SERVER
+    sf::RectangleShape body;
+    sf::CircleShape wheels[2];
+    sf::ConvexShape directionArrow;
+
+    // Brings the shapes in line with the simulation before drawing
+    void syncShapes();
+#endif
+    float rotation;
+    float speed;
+    float maxSpeed;
+    Planet* currentPlanet;
+    bool isGrounded;
+    bool isFacingRight;  // New variable to track car direction
+
+public:
+    Car(sf::Vector2f pos, sf::Vector2f vel, sf::Color col = sf::Color::Green);
+
+    void accelerate(float amount);
+    void rotate(float amount);
+    bool isOnGround() const { return isGrounded; }
+    void checkGrounding(const std::vector<Planet*>& planets);
+
+    void update(float deltaTime) override;
+#ifndef HEADLESS_SERVER
+    void draw(sf::RenderWindow& window) override;
+    void drawWithConstantSize(sf::RenderWindow& window, float zoomLevel);
+#endif
+
+    // Transfer state from rocket
+    void initializeFromRocket(const Rocket* rocket);
+    float getRotation() const { return rotation; }
+    bool getIsFacingRight() const { return isFacingRight; }
 };
\ No newline at end of file
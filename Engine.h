@@ -1,16 +1,20 @@
-// Engine.h
-#pragma once
-#include "RocketPart.h"
-
-class Engine : public RocketPart {
-private:
-    sf::ConvexShape shape;
-    float thrust;
-
-public:
-    Engine(sf::Vector2f relPos, float thrustPower, sf::Color col = sf::Color(255, 100, 0));
-
-    void draw(sf::RenderWindow& window, sf::Vector2f rocketPos, float rotation,
-        float scale = 1.0f, float thrustLevel = 0.0f, bool hasFuel = true) override;
-    float getThrust() const;
+// Engine.h
+#pragma once
+#include "RocketPart.h"
+
+class Engine : public RocketPart {
+private:
+#ifndef HEADLESS_SERVER
+    sf::ConvexShape shape;
+#endif
+    float thrust;
+
+public:
+    Engine(sf::Vector2f relPos, float thrustPower, sf::Color col = sf::Color(255, 100, 0));
+
+#ifndef HEADLESS_SERVER
+    void draw(sf::RenderWindow& window, sf::Vector2f rocketPos, float rotation,
+        float scale = 1.0f, float thrustLevel = 0.0f, bool hasFuel = true) override;
+#endif
+    float getThrust() const;
 };
\ No newline at end of file
@@ -0,0 +1,29 @@
+// EntityHandle.h
+#pragma once
+#include <cstdint>
+
+// Generational handle to a pooled object. The index names a slot, the
+// generation tells apart the objects that have lived in that slot - when the
+// slot is recycled its generation is bumped, so handles to the old object
+// stop resolving instead of silently pointing at the new one.
+// Generation 0 is never handed out, so a default handle is always invalid.
+struct EntityHandle {
+    uint32_t a; // index
+    uint32_t b; // generation
+
+    EntityHandle() : a(0), b(0) {}
+    EntityHandle(uint32_t index, uint32_t generation) : a(index), b(generation) {}
+
+    bool isValid() const { return b != 0; }
+
+    // Packed 32-bit id for the network - 16 bits of index, 16 of generation.
+    // Pools must not hand out indices above MAX_INDEX, or two live objects
+    // would share an id.
+    static constexpr uint32_t MAX_INDEX = 0xFFFF;
+    uint32_t toId() const { return (b << 16) | (a & 0xFFFF); }
+    static EntityHandle fromId(uint32_t id) { return EntityHandle(id & 0xFFFF, id >> 16); }
+
+    bool operator==(const EntityHandle& other) const { return a == other.a && b == other.b; }
+    bool operator!=(const EntityHandle& other) const { return !(*this == other); }
+    // Any strict order, so handles can key a std::map
+};
@@ -0,0 +1,66 @@
+// EntityRegistry.cpp
+#include "EntityRegistry.h"
+
+void EntityRegistry::bind(EntityHandle remote, EntityHandle local)
+{
+    if (!remote.isValid() || !local.isValid()) return;
+
+    // Drop whatever either side was bound to before
+    unbind(findRemote(local));
+    unbind(remote);
+
+    if (remote.a >= a.size()) {
+        a.resize(remote.a + 1, Link{ EntityHandle(), EntityHandle(), 0 });
+    }
+    if (local.a >= b.size()) {
+        b.resize(local.a + 1);
+    }
+
+    a[remote.a] = Link{ remote, local, 0 };
+    b[local.a] = remote;
+}
+
+void EntityRegistry::unbind(EntityHandle remote)
+{
+    if (!remote.isValid() || remote.a >= a.size() || a[remote.a].a != remote) return;
+
+    EntityHandle c = a[remote.a].b;
+    if (c.a < b.size() && b[c.a] == remote) {
+        b[c.a] = EntityHandle();
+    }
+    a[remote.a] = Link{ EntityHandle(), EntityHandle(), 0 };
+}
+
+void EntityRegistry::clear()
+{
+    a.clear();
+    b.clear();
+}
+
+EntityHandle EntityRegistry::findLocal(EntityHandle remote) const
+{
+    if (!remote.isValid() || remote.a >= a.size() || a[remote.a].a != remote) return EntityHandle();
+    return a[remote.a].b;
+}
+
+EntityHandle EntityRegistry::findRemote(EntityHandle local) const
+{
+    if (!local.isValid() || local.a >= b.size()) return EntityHandle();
+
+    // The local slot may have been recycled since it was bound
+    EntityHandle c = b[local.a];
+    if (!c.isValid() || a[c.a].b != local) return EntityHandle();
+    return c;
+}
+
+void EntityRegistry::markSeen(EntityHandle remote, unsigned long sequence)
+{
+    if (!remote.isValid() || remote.a >= a.size() || a[remote.a].a != remote) return;
+    a[remote.a].c = sequence;
+}
+
+bool EntityRegistry::wasSeen(EntityHandle remote, unsigned long sequence) const
+{
+    if (!remote.isValid() || remote.a >= a.size() || a[remote.a].a != remote) return false;
+    return a[remote.a].c == sequence;
+}
@@ -0,0 +1,32 @@
+// EntityRegistry.h
+#pragma once
+#include "EntityHandle.h"
+#include <vector>
+
+// Maps the server's entity handles to the handles of the local objects that
+// mirror them. Both directions are dense arrays indexed by slot, and both are
+// checked against the full handle, so an id the server has recycled never
+// resolves to the object that belonged to its previous owner.
+class EntityRegistry {
+private:
+    struct Link {
+        EntityHandle a; // remote
+        EntityHandle b; // local
+        unsigned long c; // lastSeen - sequence number of the last state that mentioned it
+    };
+
+    std::vector<Link> a; // byRemote - indexed by remote slot
+    std::vector<EntityHandle> b; // byLocal - remote handle, indexed by local slot
+
+public:
+    void bind(EntityHandle remote, EntityHandle local);
+    void unbind(EntityHandle remote);
+    void clear();
+
+    // Invalid handles when nothing is bound
+    EntityHandle findLocal(EntityHandle remote) const;
+    EntityHandle findRemote(EntityHandle local) const;
+
+    void markSeen(EntityHandle remote, unsigned long sequence);
+    bool wasSeen(EntityHandle remote, unsigned long sequence) const;
+};
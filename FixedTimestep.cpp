@@ -0,0 +1,32 @@
+// FixedTimestep.cpp
+#include "FixedTimestep.h"
+#include <algorithm>
+
+FixedTimestep::FixedTimestep(float rateHz, int maxSubsteps)
+    : a(1.0f / rateHz), b(0.0f), c(maxSubsteps), d(0.0f)
+{
+}
+
+void FixedTimestep::setRate(float rateHz)
+{
+    if (rateHz <= 0.0f) return;
+    a = 1.0f / rateHz;
+    b = std::min(b, a);
+}
+
+int FixedTimestep::advance(float frameTime)
+{
+    b += std::max(frameTime, 0.0f);
+
+    int a = static_cast<int>(b / this->a);
+    if (a > c) {
+        // Fell too far behind - drop the excess instead of trying to catch up,
+        // which would make the next frame even slower
+        a = c;
+        b = this->a * static_cast<float>(c);
+    }
+
+    b -= this->a * static_cast<float>(a);
+    d = std::min(std::max(b / this->a, 0.0f), 1.0f);
+    return a;
+}
@@ -0,0 +1,33 @@
+// FixedTimestep.h
+#pragma once
+
+// Fixed-rate physics clock. Frame time is accumulated and consumed in equal
+// steps, so the simulation advances identically whatever the frame rate and
+// client and server integrate with the same dt. The leftover fraction of a step
+// is exposed as an interpolation factor for rendering.
+class FixedTimestep {
+private:
+    float a; // stepSize - seconds per physics step
+    float b; // accumulator - frame time not yet simulated
+    int c; // maxSubsteps - cap per frame so a slow frame cannot snowball
+    float d; // alpha - leftover fraction of a step after the last advance()
+
+public:
+    FixedTimestep(float rateHz, int maxSubsteps);
+
+    void setRate(float rateHz);
+    void setMaxSubsteps(int maxSubsteps) { c = maxSubsteps; }
+
+    // Adds frameTime to the accumulator and returns how many steps to run now
+    int advance(float frameTime);
+
+    // Discards accumulated time, e.g. after loading or reconnecting
+    void reset() { b = 0.0f; d = 0.0f; }
+
+    float getStepSize() const { return a; }
+    float getRate() const { return 1.0f / a; }
+    int getMaxSubsteps() const { return c; }
+
+    // 0 = previous physics state, 1 = latest physics state
+    float getAlpha() const { return d; }
+};
@@ -1,649 +1,838 @@
-// GameClient.cpp
-#include "GameClient.h"
-#include "GameConstants.h"
-#include "VectorHelper.h"
-#include <iostream>
-#include <ctime>
-
-GameClient::GameClient()
-    : a(), // simulator
-    b(), // planets
-    c(), // remotePlayers
-    d(nullptr), // localPlayer
-    e(0), // localPlayerId
-    f(), // lastState
-    g(0.0f), // stateTimestamp
-    h(), // remotePlayerStates
-    i(0.05f), // latencyCompensation
-    j(ClientConnectionState::DISCONNECTED), // connectionState
-    k(false), // hasReceivedInitialState
-    l(), // localSimulation
-    m(), // simulationClock
-    n(0.0f), // simulationTime
-    o(false), // simulationPaused
-    p(0.0f), // lastServerSyncTime
-    q(0.1f), // syncInterval
-    r(false) // pendingValidation
-{
-}
-
-GameClient::~GameClient() {
-    // Clean up players
-    for (auto& a : c) {
-        delete a.second;
-    }
-    c.clear();
-
-    delete d;
-    d = nullptr;
-
-    // Clean up planets
-    for (auto& a : b) {
-        delete a;
-    }
-    b.clear();
-}
-
-void GameClient::initialize() {
-    try {
-        // Flag that we're still waiting for initial state
-        k = false;
-        j = ClientConnectionState::CONNECTING;
-
-        // Create main planet (placeholder until we get state from server)
-        Planet* a = new Planet(
-            sf::Vector2f(GameConstants::MAIN_PLANET_X, GameConstants::MAIN_PLANET_Y),
-            0, GameConstants::MAIN_PLANET_MASS, sf::Color::Blue);
-        a->setVelocity(sf::Vector2f(1.f, -1.f));
-        b.push_back(a);
-
-        // Create secondary planet
-        Planet* b = new Planet(
-            sf::Vector2f(GameConstants::SECONDARY_PLANET_X, GameConstants::SECONDARY_PLANET_Y),
-            0, GameConstants::SECONDARY_PLANET_MASS, sf::Color::Green);
-        b->setVelocity(sf::Vector2f(0.f, GameConstants::SECONDARY_PLANET_ORBITAL_VELOCITY));
-        this->b.push_back(b);
-
-        // Setup local player (placeholder until we get assigned ID)
-        sf::Vector2f c = this->b[0]->getPosition() +
-            sf::Vector2f(0, -(this->b[0]->getRadius() + GameConstants::ROCKET_SIZE));
-
-        // Always check null pointers
-        if (d) {
-            delete d;
-            d = nullptr;
-        }
-
-        // Create the local player with error checking
-        try {
-            d = new VehicleManager(c, this->b, e);
-            if (!d || !d->getRocket()) {
-                std::cerr << "Failed to create valid VehicleManager for local player" << std::endl;
-                delete d;
-                d = nullptr;
-                throw std::runtime_error("Local player creation failed");
-            }
-        }
-        catch (const std::exception& a) {
-            std::cerr << "Exception creating local player: " << a.what() << std::endl;
-            if (d) {
-                delete d;
-                d = nullptr;
-            }
-            throw; // Re-throw to inform caller
-        }
-
-        // Setup gravity simulator
-        this->a.setSimulatePlanetGravity(true);
-        this->a.setOwnerId(e); // Set owner to local player ID
-
-        for (auto a : this->b) {
-            if (a) {
-                this->a.addPlanet(a);
-            }
-        }
-
-        if (d) {
-            this->a.addVehicleManager(d);
-        }
-
-        // Initialize the local simulation
-        initializeLocalSimulation();
-
-        std::cout << "GameClient initialized successfully" << std::endl;
-    }
-    catch (const std::exception& a) {
-        std::cerr << "Exception in GameClient::initialize: " << a.what() << std::endl;
-        // Clean up any resources that might have been partially initialized
-        for (auto& a : b) {
-            delete a;
-        }
-        b.clear();
-
-        delete d;
-        d = nullptr;
-
-        // Re-throw to inform caller
-        throw;
-    }
-}
-
-void GameClient::initializeLocalSimulation() {
-    // Start with an empty local simulation
-    l = GameState();
-    l.a = 0; // Sequence number
-    l.b = 0.0f; // Timestamp
-
-    // Add local rocket if available
-    if (d && d->getRocket()) {
-        RocketState a;
-        d->createState(a);
-        l.c.push_back(a);
-    }
-
-    // Add planets
-    for (size_t a = 0; a < b.size(); ++a) {
-        Planet* b = this->b[a];
-        if (!b) continue;
-
-        PlanetState c;
-        c.a = static_cast<int>(a); // planetId
-        c.b = b->getPosition(); // position
-        c.c = b->getVelocity(); // velocity
-        c.d = b->getMass(); // mass
-        c.e = b->getRadius(); // radius
-        c.f = b->getColor(); // color
-        c.g = b->getOwnerId(); // ownerId
-        c.h = 0.0f; // timestamp
-
-        l.d.push_back(c);
-    }
-
-    // Start the simulation clock
-    m.restart();
-    n = 0.0f;
-    o = false;
-}
-
-void GameClient::update(float deltaTime) {
-    try {
-        // Skip updates if not fully connected
-        if (j != ClientConnectionState::CONNECTED && !k) {
-            return;
-        }
-
-        // Update the simulation time
-        if (!o) {
-            n += deltaTime;
-        }
-
-        // Run local simulation if not paused
-        if (!o) {
-            runLocalSimulation(deltaTime);
-        }
-
-        // Update simulator with null checking
-        this->a.update(deltaTime);
-
-        // Update planets with null checking
-        for (auto a : b) {
-            if (a) {
-                a->update(deltaTime);
-            }
-        }
-
-        // Update local player with null checking
-        if (d) {
-            d->update(deltaTime);
-        }
-
-        // Update remote players with null checking
-        for (auto& a : c) {
-            if (a.second) {
-                a.second->update(deltaTime);
-            }
-        }
-
-        // Check if it's time to sync with server
-        if (m.getElapsedTime().asSeconds() >= q && !o && !r) {
-            // Update local simulation with current state
-            if (d && d->getRocket()) {
-                RocketState a;
-                d->createState(a);
-
-                // Update or add our rocket in the local simulation
-                bool b = false;
-                for (auto& c : l.c) {
-                    if (c.a == e) {
-                        c = a;
-                        b = true;
-                        break;
-                    }
-                }
-
-                if (!b) {
-                    l.c.push_back(a);
-                }
-
-                // Update the timestamp
-                l.b = n;
-
-                // Set flag for sending to server
-                r = true;
-            }
-        }
-    }
-    catch (const std::exception& a) {
-        std::cerr << "Exception in GameClient::update: " << a.what() << std::endl;
-        // Continue execution - don't re-throw from update
-    }
-}
-
-void GameClient::runLocalSimulation(float deltaTime) {
-    // Skip if not ready
-    if (j != ClientConnectionState::CONNECTED || !k) {
-        return;
-    }
-
-    // Make local changes to the simulation
-    if (d && d->getRocket()) {
-        // Update the rocket state in local simulation
-        RocketState a;
-        d->createState(a);
-
-        // Update or add this rocket in the simulation
-        bool b = false;
-        for (auto& c : l.c) {
-            if (c.a == e) {
-                c = a;
-                b = true;
-                break;
-            }
-        }
-
-        if (!b) {
-            l.c.push_back(a);
-        }
-    }
-
-    // Update planets in local simulation
-    for (size_t a = 0; a < b.size() && a < l.d.size(); ++a) {
-        Planet* b = this->b[a];
-        if (!b) continue;
-
-        l.d[a].b = b->getPosition();
-        l.d[a].c = b->getVelocity();
-        l.d[a].d = b->getMass();
-    }
-
-    // Update timestamp
-    l.b = n;
-}
-
-void GameClient::processServerValidation(const GameState& validatedState) {
-    // Reset the validation pending flag
-    r = false;
-
-    // Update last server sync time
-    p = n;
-
-    // Check if server rejected our simulation
-    if (validatedState.e) { // isInitialState flag is used to indicate server override
-        // Server is overriding our state - pause simulation
-        o = true;
-
-        // Apply the server's state
-        processGameState(validatedState);
-
-        // Resume simulation
-        o = false;
-
-        // Reset simulation time to server time
-        n = validatedState.b;
-
-        // Reset the local simulation to match server state
-        l = validatedState;
-    }
-
-    // Otherwise, server accepted our simulation - continue normally
-}
-
-void GameClient::processGameState(const GameState& state) {
-    try {
-        // Don't process empty states
-        if (state.d.empty()) {
-            std::cerr << "Received empty game state, ignoring" << std::endl;
-            return;
-        }
-
-        // Update last state
-        f = state;
-        g = state.b;
-
-        // Update connection state if this is our first state
-        if (!k) {
-            std::cout << "Received initial game state with " << state.d.size() << " planets and "
-                << state.c.size() << " rockets" << std::endl;
-
-            j = ClientConnectionState::CONNECTED;
-            k = true;
-            std::cout << "Client now fully connected and ready for gameplay" << std::endl;
-
-            // Initialize local simulation with this state
-            l = state;
-            n = state.b;
-            m.restart();
-        }
-
-        // Process planets - ensure we have the right number of planets
-        for (const auto& a : state.d) {
-            if (a.a < 0) {
-                std::cerr << "Invalid planet ID: " << a.a << std::endl;
-                continue;
-            }
-
-            // Make sure we have enough planets
-            while (a.a >= static_cast<int>(b.size())) {
-                try {
-                    Planet* b = new Planet(sf::Vector2f(0, 0), 0, 1.0f);
-                    this->b.push_back(b);
-                    this->a.addPlanet(b);
-                }
-                catch (const std::exception& b) {
-                    std::cerr << "Exception creating new planet: " << b.what() << std::endl;
-                    break;
-                }
-            }
-
-            // Update planet state
-            if (a.a < static_cast<int>(b.size())) {
-                Planet* b = this->b[a.a];
-                if (b) {
-                    b->setPosition(a.b);
-                    b->setVelocity(a.c);
-                    b->setMass(a.d);
-                    b->setOwnerId(a.g); // Set owner ID
-                }
-            }
-        }
-
-        // Process rockets
-        for (const auto& a : state.c) {
-            // First ensure we have a valid local player initialized
-            if (!d && !b.empty()) {
-                try {
-                    sf::Vector2f b = this->b[0]->getPosition() +
-                        sf::Vector2f(0, -(this->b[0]->getRadius() + GameConstants::ROCKET_SIZE));
-                    d = new VehicleManager(b, this->b, e);
-                    this->a.addVehicleManager(d);
-                    std::cout << "Created local player (was null)" << std::endl;
-                }
-                catch (const std::exception& b) {
-                    std::cerr << "Exception creating local player: " << b.what() << std::endl;
-                    continue;
-                }
-            }
-
-            // Process rocket based on player ID
-            if (a.a == e) {
-                // This is our local player - only update if server state is authoritative
-                if (a.j) {
-                    if (!d) {
-                        // Create local player if it doesn't exist
-                        try {
-                            d = new VehicleManager(a.b, b, e);
-                            this->a.addVehicleManager(d);
-                            std::cout << "Created local player with ID: " << e << std::endl;
-
-                            // Verify the rocket was actually created
-                            if (!d->getRocket()) {
-                                std::cerr << "ERROR: Local player created but rocket is null!" << std::endl;
-                                delete d;
-                                d = nullptr;
-                                continue;
-                            }
-                            else {
-                                std::cout << "Successfully created rocket for local player" << std::endl;
-                            }
-                        }
-                        catch (const std::exception& b) {
-                            std::cerr << "Exception creating local player: " << b.what() << std::endl;
-                            continue;
-                        }
-                    }
-
-                    // Apply the server state to our local rocket
-                    if (d && d->getRocket()) {
-                        d->applyState(a);
-                        std::cout << "Updated local rocket position: " << a.b.x << ", " << a.b.y << std::endl;
-                    }
-                    else {
-                        std::cerr << "ERROR: Local player exists but rocket is null after state update" << std::endl;
-                    }
-                }
-            }
-            else {
-                // This is a remote player
-                VehicleManager* b = nullptr;
-                auto c = this->c.find(a.a);
-
-                if (c == this->c.end()) {
-                    // Create a new remote player
-                    try {
-                        b = new VehicleManager(a.b, this->b, a.a);
-                        if (b && b->getRocket()) {
-                            this->c[a.a] = b;
-                            this->a.addVehicleManager(b);
-
-                            // Set color based on player ID
-                            b->getRocket()->setColor(a.h);
-
-                            std::cout << "Added remote player with ID: " << a.a << std::endl;
-                        }
-                        else {
-                            std::cerr << "Failed to create valid VehicleManager for remote player" << std::endl;
-                            delete b; // Clean up if rocket initialization failed
-                        }
-                    }
-                    catch (const std::exception& c) {
-                        std::cerr << "Exception creating remote player: " << c.what() << std::endl;
-                        delete b; // Clean up on exception
-                        continue;
-                    }
-                }
-                else {
-                    b = c->second;
-                }
-                // Update rocket state with interpolation if manager exists
-                if (b && b->getRocket()) {
-                    Rocket* d = b->getRocket();
-
-                    // Store previous position for interpolation
-                    sf::Vector2f e = d->getPosition();
-                    sf::Vector2f f = d->getVelocity();
-
-                    // Update with server values
-                    d->setPosition(a.b);
-                    d->setVelocity(a.c);
-                    d->setRotation(a.d);
-                    d->setThrustLevel(a.f);
-
-                    // Store for interpolation
-                    h[a.a] = {
-                        e, f,
-                        a.b, a.c,
-                        a.d,
-                        state.b
-                    };
-                }
-            }
-        }
-
-        // Remove any players that weren't in the update
-        std::vector<int> a;
-        for (const auto& b : c) {
-            bool c = false;
-            for (const auto& d : state.c) {
-                if (d.a == b.first) {
-                    c = true;
-                    break;
-                }
-            }
-
-            if (!c) {
-                a.push_back(b.first);
-            }
-        }
-
-        for (int a : a) {
-            std::cout << "Remote player " << a << " disconnected" << std::endl;
-            if (c[a]) {
-                this->a.removeVehicleManager(c[a]);
-                delete c[a];
-            }
-            c.erase(a);
-            h.erase(a);
-        }
-    }
-    catch (const std::exception& a) {
-        std::cerr << "Exception in processGameState: " << a.what() << std::endl;
-    }
-}
-
-void GameClient::setLatencyCompensation(float value) {
-    i = value;
-}
-
-void GameClient::setLocalPlayerId(int id) {
-    e = id;
-    j = ClientConnectionState::WAITING_FOR_STATE;
-    std::cout << "Local player ID set to: " << id << ", waiting for initial game state..." << std::endl;
-
-    // Also set the owner ID for local objects
-    if (d) {
-        d->setOwnerId(id);
-        if (d->getRocket()) {
-            d->getRocket()->setOwnerId(id);
-        }
-    }
-
-    // Set simulator owner ID
-    a.setOwnerId(id);
-}
-
-PlayerInput GameClient::getLocalPlayerInput(float deltaTime) const {
-    PlayerInput a;
-    a.a = e; // playerId
-    a.h = deltaTime; // deltaTime
-    a.i = n; // clientTimestamp
-    a.j = g; // lastServerStateTimestamp
-
-    // Skip input collection if not fully connected
-    if (j != ClientConnectionState::CONNECTED || !k || !d) {
-        return a;
-    }
-
-    // Get keyboard state
-    a.b = sf::Keyboard::isKeyPressed(sf::Keyboard::Key::W); // thrustForward
-    a.c = sf::Keyboard::isKeyPressed(sf::Keyboard::Key::S); // thrustBackward
-    a.d = sf::Keyboard::isKeyPressed(sf::Keyboard::Key::A); // rotateLeft
-    a.e = sf::Keyboard::isKeyPressed(sf::Keyboard::Key::D); // rotateRight
-    a.f = sf::Keyboard::isKeyPressed(sf::Keyboard::Key::L); // switchVehicle
-
-    // Get thrust level
-    if (d && d->getActiveVehicleType() == VehicleType::ROCKET && d->getRocket()) {
-        a.g = d->getRocket()->getThrustLevel(); // thrustLevel
-
-        // Include current rocket state
-        if (r) { // If pending validation
-            RocketState b;
-            d->createState(b);
-            a.k = b; // clientRocketState
-        }
-    }
-
-    return a;
-}
-
-void GameClient::applyLocalInput(const PlayerInput& input) {
-    // Skip if not fully connected or no local player
-    if (!k || j != ClientConnectionState::CONNECTED || !d) {
-        return;
-    }
-
-    try {
-        // Apply input to local player immediately for responsive feel
-        if (input.b) {
-            d->applyThrust(1.0f);
-        }
-        if (input.c) {
-            d->applyThrust(-0.5f);
-        }
-        if (input.d) {
-            d->rotate(-6.0f * input.h * 60.0f);
-        }
-        if (input.e) {
-            d->rotate(6.0f * input.h * 60.0f);
-        }
-        if (input.f) {
-            d->switchVehicle();
-        }
-
-        // Apply thrust level
-        if (d->getActiveVehicleType() == VehicleType::ROCKET && d->getRocket()) {
-            d->getRocket()->setThrustLevel(input.g);
-        }
-    }
-    catch (const std::exception& a) {
-        std::cerr << "Exception in applyLocalInput: " << a.what() << std::endl;
-    }
-}
-
-void GameClient::interpolateRemotePlayers(float currentTime) {
-    // Skip if not fully connected
-    if (!k || j != ClientConnectionState::CONNECTED) {
-        return;
-    }
-
-    try {
-        for (auto a = h.begin(); a != h.end(); ) {
-            int b = a->first;
-            RemotePlayerState& c = a->second;
-
-            auto d = this->c.find(b);
-            if (d == this->c.end() || !d->second || !d->second->getRocket()) {
-                // Remove stale state if player no longer exists
-                a = h.erase(a);
-                continue;
-            }
-
-            VehicleManager* e = d->second;
-            Rocket* f = e->getRocket();
-            if (!f) {
-                ++a;
-                continue;
-            }
-
-            // Calculate interpolation factor
-            float g = currentTime - c.f;
-            float h = std::min(g / i, 1.0f);
-
-            // Interpolate position and velocity
-            sf::Vector2f i = c.a + (c.c - c.a) * h;
-            sf::Vector2f j = c.b + (c.d - c.b) * h;
-
-            try {
-                f->setPosition(i);
-                f->setVelocity(j);
-            }
-            catch (const std::exception& a) {
-                std::cerr << "Exception in interpolateRemotePlayers: " << a.what() << std::endl;
-            }
-
-            ++a;
-        }
-    }
-    catch (const std::exception& a) {
-        std::cerr << "Exception in interpolateRemotePlayers: " << a.what() << std::endl;
-    }
+// GameClient.cpp
+#include "GameClient.h"
+#include "GameConstants.h"
+#include "PlanetPool.h"
+#include "VectorHelper.h"
+#include <iostream>
+#include <ctime>
+#include <utility>
+#include <cmath>
+#include <algorithm>
+
+namespace {
+    // States list entities in a stable order, so the hint nearly always hits
+    template <typename List, typename Id>
+    auto findById(const List& list, Id id, size_t& hint) -> decltype(&list[0]) {
+        for (size_t a = 0; a < list.size(); a++) {
+            size_t b = (hint + a) % list.size();
+            if (list[b].a == id) {
+                hint = b + 1;
+                return &list[b];
+            }
+        }
+        return nullptr;
+    }
+
+    bool sameValues(const PlanetState& a, const PlanetState& b) {
+        return a.b == b.b && a.c == b.c && a.d == b.d && a.g == b.g;
+    }
+
+    bool sameValues(const RocketState& a, const RocketState& b) {
+        return a.b == b.b && a.c == b.c && a.d == b.d && a.f == b.f;
+    }
+
+    // Cubic Hermite between two snapshots - the curve passes through both
+    // positions with both velocities, so it bends the way the rocket did
+    RemoteSnapshot hermite(const RemoteSnapshot& a, const RemoteSnapshot& b, float time) {
+        float c = b.e - a.e; // interval
+        float t = (time - a.e) / c;
+        float t2 = t * t;
+        float t3 = t2 * t;
+
+        RemoteSnapshot d;
+        d.a = a.a * (2.0f * t3 - 3.0f * t2 + 1.0f) + a.b * (c * (t3 - 2.0f * t2 + t)) +
+            b.a * (-2.0f * t3 + 3.0f * t2) + b.b * (c * (t3 - t2));
+        d.b = (a.a * (6.0f * t2 - 6.0f * t) + b.a * (-6.0f * t2 + 6.0f * t)) / c +
+            a.b * (3.0f * t2 - 4.0f * t + 1.0f) + b.b * (3.0f * t2 - 2.0f * t);
+
+        // Rotation in degrees, the short way round
+        float e = std::fmod(b.c - a.c, 360.0f);
+        if (e > 180.0f) e -= 360.0f;
+        if (e < -180.0f) e += 360.0f;
+        d.c = a.c + e * t;
+
+        d.d = a.d;
+        d.e = time;
+        return d;
+    }
+}
+
+GameClient::GameClient()
+    : a(), // simulator
+    b(), // planets
+    c(), // remotePlayers
+    d(nullptr), // localPlayer
+    e(0), // localPlayerId
+    f(), // lastState
+    g(0.0f), // stateTimestamp
+    h(), // remotePlayerStates
+    i(GameConstants::INTERPOLATION_DELAY), // latencyCompensation
+    j(ClientConnectionState::DISCONNECTED), // connectionState
+    k(false), // hasReceivedInitialState
+    l(), // localSimulation
+    m(), // simulationClock
+    n(0.0f), // simulationTime
+    o(false), // simulationPaused
+    p(0.0f), // lastServerSyncTime
+    q(0.1f), // syncInterval
+    r(false), // pendingValidation
+    s(), // planetIds
+    t(GameConstants::PREDICTION_INPUT_BUFFER), // inputHistory
+    u(0), // inputSequence
+    v(0), // ackedInputSequence
+    w(0.0f), // serverClockOffset
+    x(false) // hasServerClockOffset
+{
+}
+
+GameClient::~GameClient() {
+    // Clean up players
+    for (auto& a : c) {
+        delete a.second;
+    }
+    c.clear();
+
+    delete d;
+    d = nullptr;
+
+    // Clean up planets
+    for (auto& a : b) {
+        PlanetPool::getInstance().destroy(a);
+    }
+    b.clear();
+}
+
+void GameClient::initialize() {
+    try {
+        // Flag that we're still waiting for initial state
+        k = false;
+        j = ClientConnectionState::CONNECTING;
+
+        // Create main planet (placeholder until we get state from server)
+        Planet* a = PlanetPool::getInstance().create(
+            sf::Vector2f(GameConstants::MAIN_PLANET_X, GameConstants::MAIN_PLANET_Y),
+            0, GameConstants::MAIN_PLANET_MASS, sf::Color::Blue);
+        a->setVelocity(sf::Vector2f(1.f, -1.f));
+        b.push_back(a);
+
+        // Create secondary planet
+        Planet* b = PlanetPool::getInstance().create(
+            sf::Vector2f(GameConstants::SECONDARY_PLANET_X, GameConstants::SECONDARY_PLANET_Y),
+            0, GameConstants::SECONDARY_PLANET_MASS, sf::Color::Green);
+        b->setVelocity(sf::Vector2f(0.f, GameConstants::SECONDARY_PLANET_ORBITAL_VELOCITY));
+        this->b.push_back(b);
+
+        // Setup local player (placeholder until we get assigned ID)
+        sf::Vector2f c = this->b[0]->getPosition() +
+            sf::Vector2f(0, -(this->b[0]->getRadius() + GameConstants::ROCKET_SIZE));
+
+        // Always check null pointers
+        if (d) {
+            delete d;
+            d = nullptr;
+        }
+
+        // Create the local player with error checking
+        try {
+            d = new VehicleManager(c, this->b, e);
+            if (!d || !d->getRocket()) {
+                std::cerr << "Failed to create valid VehicleManager for local player" << std::endl;
+                delete d;
+                d = nullptr;
+                throw std::runtime_error("Local player creation failed");
+            }
+        }
+        catch (const std::exception& a) {
+            std::cerr << "Exception creating local player: " << a.what() << std::endl;
+            if (d) {
+                delete d;
+                d = nullptr;
+            }
+            throw; // Re-throw to inform caller
+        }
+
+        // Setup gravity simulator
+        this->a.setSimulatePlanetGravity(true);
+        this->a.setOwnerId(e); // Set owner to local player ID
+
+        for (auto a : this->b) {
+            if (a) {
+                this->a.addPlanet(a);
+            }
+        }
+
+        if (d) {
+            this->a.addVehicleManager(d);
+        }
+
+        // Initialize the local simulation
+        initializeLocalSimulation();
+
+        std::cout << "GameClient initialized successfully" << std::endl;
+    }
+    catch (const std::exception& a) {
+        std::cerr << "Exception in GameClient::initialize: " << a.what() << std::endl;
+        // Clean up any resources that might have been partially initialized
+        for (auto& a : b) {
+            PlanetPool::getInstance().destroy(a);
+        }
+        b.clear();
+
+        delete d;
+        d = nullptr;
+
+        // Re-throw to inform caller
+        throw;
+    }
+}
+
+void GameClient::initializeLocalSimulation() {
+    // Start with an empty local simulation
+    l = GameState();
+    l.a = 0; // Sequence number
+    l.b = 0.0f; // Timestamp
+
+    // Add local rocket if available
+    if (d && d->getRocket()) {
+        RocketState a;
+        d->createState(a);
+        l.c.push_back(a);
+    }
+
+    // Add planets
+    for (size_t a = 0; a < b.size(); ++a) {
+        Planet* b = this->b[a];
+        if (!b) continue;
+
+        PlanetState c;
+        fillPlanetState(c, b);
+        l.d.push_back(c);
+    }
+
+    // Start the simulation clock
+    m.restart();
+    n = 0.0f;
+    o = false;
+}
+
+void GameClient::update(float deltaTime) {
+    try {
+        // Skip updates if not fully connected
+        if (j != ClientConnectionState::CONNECTED && !k) {
+            return;
+        }
+
+        // Update the simulation time
+        if (!o) {
+            n += deltaTime;
+        }
+
+        // Run local simulation if not paused
+        if (!o) {
+            runLocalSimulation(deltaTime);
+        }
+
+        // Update simulator with null checking
+        this->a.update(deltaTime);
+
+        // Merges may have destroyed planets - the simulator's list is the live one
+        b = this->a.getPlanets();
+
+        // Update planets with null checking
+        for (auto a : b) {
+            if (a) {
+                a->update(deltaTime);
+            }
+        }
+
+        // Update local player with null checking
+        if (d) {
+            d->update(deltaTime);
+        }
+
+        // Remote players follow the server's snapshots, not our physics
+        interpolateRemotePlayers(n);
+
+        // Check if it's time to sync with server
+        if (m.getElapsedTime().asSeconds() >= q && !o && !r) {
+            // Update local simulation with current state
+            if (d && d->getRocket()) {
+                RocketState a;
+                d->createState(a);
+
+                // Update or add our rocket in the local simulation
+                bool b = false;
+                for (auto& c : l.c) {
+                    if (c.a == e) {
+                        c = a;
+                        b = true;
+                        break;
+                    }
+                }
+
+                if (!b) {
+                    l.c.push_back(a);
+                }
+
+                // Update the timestamp
+                l.b = n;
+
+                // Set flag for sending to server
+                r = true;
+            }
+        }
+    }
+    catch (const std::exception& a) {
+        std::cerr << "Exception in GameClient::update: " << a.what() << std::endl;
+        // Continue execution - don't re-throw from update
+    }
+}
+
+void GameClient::runLocalSimulation(float deltaTime) {
+    // Skip if not ready
+    if (j != ClientConnectionState::CONNECTED || !k) {
+        return;
+    }
+
+    // Make local changes to the simulation
+    if (d && d->getRocket()) {
+        // Update the rocket state in local simulation
+        RocketState a;
+        d->createState(a);
+
+        // Update or add this rocket in the simulation
+        bool b = false;
+        for (auto& c : l.c) {
+            if (c.a == e) {
+                c = a;
+                b = true;
+                break;
+            }
+        }
+
+        if (!b) {
+            l.c.push_back(a);
+        }
+    }
+
+    // Update planets in local simulation - the list may have changed since the last tick
+    l.d.clear();
+    for (auto a : b) {
+        if (!a) continue;
+
+        PlanetState b;
+        fillPlanetState(b, a);
+        l.d.push_back(b);
+    }
+
+    // Update timestamp
+    l.b = n;
+}
+
+void GameClient::processServerValidation(const GameState& validatedState) {
+    // Reset the validation pending flag
+    r = false;
+
+    // Update last server sync time
+    p = n;
+
+    // Check if server rejected our simulation
+    if (validatedState.e) { // isInitialState flag is used to indicate server override
+        // Rewind to the server's rocket and replay what it has not applied yet,
+        // rather than snapping to a state that is already a round trip old
+        for (const auto& a : validatedState.c) {
+            if (a.a == e) {
+                reconcile(a, validatedState.f);
+                break;
+            }
+        }
+    }
+
+    // Otherwise, server accepted our simulation - continue normally
+}
+
+void GameClient::reconcile(const RocketState& serverState, uint32_t ackedSequence) {
+    if (!d || d->getActiveVehicleType() != VehicleType::ROCKET || !d->getRocket()) {
+        return;
+    }
+
+    // States arrive in order, but a validation may carry an older ack
+    if (static_cast<int32_t>(ackedSequence - v) < 0) {
+        return;
+    }
+    v = ackedSequence;
+
+    Rocket* a = d->getRocket();
+    RocketState b = a->createState(); // predicted
+
+    // Rewind to what the server has, then redo every input it has not seen
+    // with the same physics the live step uses. The planets stay where they
+    // are now - over a round trip they barely move.
+    a->rewindTo(serverState);
+    d->setLastStateTimestamp(serverState.i);
+
+    uint32_t c = u - v; // unacked
+    if (c > t.size()) {
+        c = static_cast<uint32_t>(t.size()); // The oldest fell out of the buffer
+    }
+
+    this->a.beginReplay();
+    for (uint32_t f = u - c + 1; c > 0; f++, c--) {
+        PlayerInput g = t[f % t.size()];
+        if (g.l != f) continue;
+
+        // The vehicle switch already happened - only the controls are redone
+        g.f = false;
+        applyInput(g);
+        this->a.applyGravityToRocket(a, g.h);
+        a->update(g.h);
+    }
+
+    // Quantized states never match exactly - keep the prediction unless the
+    // replay really ended up somewhere else
+    sf::Vector2f h = a->getPosition() - b.b;
+    if (h.x * h.x + h.y * h.y < GameConstants::PREDICTION_CORRECTION_EPSILON * GameConstants::PREDICTION_CORRECTION_EPSILON) {
+        a->rewindTo(b);
+    }
+}
+
+void GameClient::fillPlanetState(PlanetState& state, const Planet* planet) const {
+    state.a = s.findRemote(planet->getHandle()).toId(); // planetId - 0 until the server knows it
+    state.b = planet->getPosition(); // position
+    state.c = planet->getVelocity(); // velocity
+    state.d = planet->getMass(); // mass
+    state.e = planet->getRadius(); // radius
+    state.f = planet->getColor(); // color
+    state.g = planet->getOwnerId(); // ownerId
+    state.h = 0.0f; // timestamp
+}
+
+void GameClient::removeUnseenPlanets(unsigned long sequence) {
+    // Also drops the placeholder planets made before the first state arrived
+    size_t a = 0;
+    for (size_t b = 0; b < this->b.size(); b++) {
+        Planet* c = this->b[b];
+        if (!c) continue;
+
+        EntityHandle d = s.findRemote(c->getHandle());
+        if (d.isValid() && s.wasSeen(d, sequence)) {
+            this->b[a++] = c;
+            continue;
+        }
+
+        this->a.removePlanet(c);
+        s.unbind(d);
+        PlanetPool::getInstance().destroy(c);
+    }
+
+    if (a == this->b.size()) return;
+    this->b.resize(a);
+
+    // Remote rockets keep their own planet lists
+    for (auto& b : this->c) {
+        if (b.second) {
+            b.second->updatePlanets(this->b);
+        }
+    }
+}
+
+void GameClient::processGameState(const GameState& state) {
+    try {
+        // Don't process empty states
+        if (state.d.empty()) {
+            std::cerr << "Received empty game state, ignoring" << std::endl;
+            return;
+        }
+
+        // Update last state, keeping the previous one to tell what is new
+        GameState previous;
+        std::swap(previous, f);
+        f = state;
+        g = state.b;
+        size_t planetHint = 0;
+        size_t rocketHint = 0;
+
+        // Update connection state if this is our first state
+        if (!k) {
+            std::cout << "Received initial game state with " << state.d.size() << " planets and "
+                << state.c.size() << " rockets" << std::endl;
+
+            j = ClientConnectionState::CONNECTED;
+            k = true;
+            std::cout << "Client now fully connected and ready for gameplay" << std::endl;
+
+            // Initialize local simulation with this state
+            l = state;
+            n = state.b;
+            m.restart();
+        }
+
+        // Server time runs ahead of ours by about the one-way delay. Smoothed,
+        // so a state that arrives late does not make remote players jump.
+        float clockSample = state.b - n;
+        if (!x || std::abs(clockSample - w) > GameConstants::SERVER_CLOCK_RESYNC) {
+            w = clockSample;
+            x = true;
+        }
+        else {
+            w += (clockSample - w) * GameConstants::SERVER_CLOCK_SMOOTHING;
+        }
+
+        // Process planets - matched by the server's handle, not by list position
+        for (const auto& a : state.d) {
+            EntityHandle b = EntityHandle::fromId(a.a);
+            if (!b.isValid()) {
+                std::cerr << "Invalid planet ID: " << a.a << std::endl;
+                continue;
+            }
+
+            Planet* c = this->a.findPlanet(s.findLocal(b));
+
+            // Bodies the server did not refresh for us repeat the values it sent
+            // before - re-applying those would pull our copy back in time
+            const PlanetState* d = findById(previous.d, a.a, planetHint);
+            if (c && d && sameValues(a, *d)) {
+                s.markSeen(b, state.a);
+                continue;
+            }
+
+            if (!c) {
+                // New to us (or our copy was merged away locally) - mirror it
+                try {
+                    c = PlanetPool::getInstance().create(a.b, 0, a.d, a.f, a.g);
+                    this->b.push_back(c);
+                    this->a.addPlanet(c);
+                    s.bind(b, c->getHandle());
+                }
+                catch (const std::exception& d) {
+                    std::cerr << "Exception creating new planet: " << d.what() << std::endl;
+                    continue;
+                }
+            }
+
+            // Update planet state
+            c->setPosition(a.b);
+            c->setVelocity(a.c);
+            c->setMass(a.d);
+            c->setOwnerId(a.g); // Set owner ID
+            s.markSeen(b, state.a);
+        }
+
+        // Every state lists every planet, so the ones it left out are gone on the server
+        removeUnseenPlanets(state.a);
+
+        // Process rockets
+        for (const auto& a : state.c) {
+            // First ensure we have a valid local player initialized
+            if (!d && !b.empty()) {
+                try {
+                    sf::Vector2f b = this->b[0]->getPosition() +
+                        sf::Vector2f(0, -(this->b[0]->getRadius() + GameConstants::ROCKET_SIZE));
+                    d = new VehicleManager(b, this->b, e);
+                    this->a.addVehicleManager(d);
+                    std::cout << "Created local player (was null)" << std::endl;
+                }
+                catch (const std::exception& b) {
+                    std::cerr << "Exception creating local player: " << b.what() << std::endl;
+                    continue;
+                }
+            }
+
+            // Process rocket based on player ID
+            if (a.a == e) {
+                // This is our local player - only update if server state is authoritative
+                if (a.j) {
+                    if (!d) {
+                        // Create local player if it doesn't exist
+                        try {
+                            d = new VehicleManager(a.b, b, e);
+                            std::cout << "Created local player with ID: " << e << std::endl;
+
+                            // Verify the rocket was actually created
+                            if (!d->getRocket()) {
+                                std::cerr << "ERROR: Local player created but rocket is null!" << std::endl;
+                                delete d;
+                                d = nullptr;
+                                continue;
+                            }
+                            else {
+                                this->a.addVehicleManager(d);
+                                std::cout << "Successfully created rocket for local player" << std::endl;
+                            }
+                        }
+                        catch (const std::exception& b) {
+                            std::cerr << "Exception creating local player: " << b.what() << std::endl;
+                            continue;
+                        }
+                    }
+
+                    // Rewind to the server state and replay our unacked inputs on top
+                    if (d && d->getRocket()) {
+                        if (d->getActiveVehicleType() == VehicleType::ROCKET) {
+                            reconcile(a, state.f);
+                        }
+                        else {
+                            d->applyState(a);
+                        }
+                    }
+                    else {
+                        std::cerr << "ERROR: Local player exists but rocket is null after state update" << std::endl;
+                    }
+                }
+            }
+            else {
+                // This is a remote player
+                VehicleManager* b = nullptr;
+                auto c = this->c.find(a.a);
+
+                if (c == this->c.end()) {
+                    // Create a new remote player
+                    try {
+                        b = new VehicleManager(a.b, this->b, a.a);
+                        if (b && b->getRocket()) {
+                            // Snapshots drive remote players, so the simulator
+                            // keeps the local one as its vehicle
+                            this->c[a.a] = b;
+
+                            // Set color based on player ID
+                            b->getRocket()->setColor(a.h);
+
+                            std::cout << "Added remote player with ID: " << a.a << std::endl;
+                        }
+                        else {
+                            std::cerr << "Failed to create valid VehicleManager for remote player" << std::endl;
+                            delete b; // Clean up if rocket initialization failed
+                        }
+                    }
+                    catch (const std::exception& c) {
+                        std::cerr << "Exception creating remote player: " << c.what() << std::endl;
+                        delete b; // Clean up on exception
+                        continue;
+                    }
+                }
+                else {
+                    b = c->second;
+
+                    // Not refreshed this time - a repeat is not a new snapshot
+                    const RocketState* d = findById(previous.c, a.a, rocketHint);
+                    if (d && sameValues(a, *d)) {
+                        continue;
+                    }
+                }
+                // Queue the snapshot - interpolateRemotePlayers moves the rocket through it
+                if (b && b->getRocket()) {
+                    std::deque<RemoteSnapshot>& d = h[a.a].a;
+                    if (d.empty() || state.b > d.back().e) {
+                        RemoteSnapshot e;
+                        e.a = a.b; // position
+                        e.b = a.c; // velocity
+                        e.c = a.d; // rotation
+                        e.d = a.f; // thrustLevel
+                        e.e = state.b; // timestamp
+                        d.push_back(e);
+
+                        if (d.size() > GameConstants::REMOTE_SNAPSHOT_BUFFER) {
+                            d.pop_front();
+                        }
+                    }
+                }
+            }
+        }
+
+        // Remove any players that weren't in the update
+        std::vector<int> a;
+        for (const auto& b : c) {
+            bool c = false;
+            for (const auto& d : state.c) {
+                if (d.a == b.first) {
+                    c = true;
+                    break;
+                }
+            }
+
+            if (!c) {
+                a.push_back(b.first);
+            }
+        }
+
+        for (int a : a) {
+            std::cout << "Remote player " << a << " disconnected or out of range" << std::endl;
+            delete c[a];
+            c.erase(a);
+            h.erase(a);
+        }
+    }
+    catch (const std::exception& a) {
+        std::cerr << "Exception in processGameState: " << a.what() << std::endl;
+    }
+}
+
+void GameClient::setLatencyCompensation(float value) {
+    i = value;
+}
+
+void GameClient::setLocalPlayerId(int id) {
+    e = id;
+    j = ClientConnectionState::WAITING_FOR_STATE;
+
+    // The server counts our inputs from scratch for a new id
+    t.assign(t.size(), PlayerInput());
+    u = 0;
+    v = 0;
+    std::cout << "Local player ID set to: " << id << ", waiting for initial game state..." << std::endl;
+
+    // Also set the owner ID for local objects
+    if (d) {
+        d->setOwnerId(id);
+        if (d->getRocket()) {
+            d->getRocket()->setOwnerId(id);
+        }
+    }
+
+    // Set simulator owner ID
+    a.setOwnerId(id);
+}
+
+PlayerInput GameClient::getLocalPlayerInput(float deltaTime) const {
+    PlayerInput a;
+    a.a = e; // playerId
+    a.h = deltaTime; // deltaTime
+    a.i = n; // clientTimestamp
+    a.j = g; // lastServerStateTimestamp
+
+    // Skip input collection if not fully connected
+    if (j != ClientConnectionState::CONNECTED || !k || !d) {
+        return a;
+    }
+
+#ifndef HEADLESS_SERVER
+    // Get keyboard state - the dedicated server has no keyboard and sends no input
+    a.b = sf::Keyboard::isKeyPressed(sf::Keyboard::Key::W); // thrustForward
+    a.c = sf::Keyboard::isKeyPressed(sf::Keyboard::Key::S); // thrustBackward
+    a.d = sf::Keyboard::isKeyPressed(sf::Keyboard::Key::A); // rotateLeft
+    a.e = sf::Keyboard::isKeyPressed(sf::Keyboard::Key::D); // rotateRight
+    a.f = sf::Keyboard::isKeyPressed(sf::Keyboard::Key::L); // switchVehicle
+#endif
+
+    // Get thrust level
+    if (d && d->getActiveVehicleType() == VehicleType::ROCKET && d->getRocket()) {
+        a.g = d->getRocket()->getThrustLevel(); // thrustLevel
+
+        // Include current rocket state
+        if (r) { // If pending validation
+            RocketState b;
+            d->createState(b);
+            a.k = b; // clientRocketState
+        }
+    }
+
+    return a;
+}
+
+void GameClient::applyLocalInput(PlayerInput& input) {
+    // Skip if not fully connected or no local player
+    if (!k || j != ClientConnectionState::CONNECTED || !d) {
+        return;
+    }
+
+    try {
+        // Kept until the server acks it, in case we have to replay it
+        input.l = ++u;
+        t[input.l % t.size()] = input;
+
+        // Apply input to local player immediately for responsive feel
+        applyInput(input);
+    }
+    catch (const std::exception& a) {
+        std::cerr << "Exception in applyLocalInput: " << a.what() << std::endl;
+    }
+}
+
+void GameClient::applyInput(const PlayerInput& input) {
+    // Same controls as GameServer::applyPlayerInput
+    if (input.b) {
+        d->applyThrust(1.0f);
+    }
+    if (input.c) {
+        d->applyThrust(-0.5f);
+    }
+    if (input.d) {
+        d->rotate(-6.0f * input.h * 60.0f);
+    }
+    if (input.e) {
+        d->rotate(6.0f * input.h * 60.0f);
+    }
+    if (input.f) {
+        d->switchVehicle();
+    }
+
+    // Apply thrust level
+    if (d->getActiveVehicleType() == VehicleType::ROCKET && d->getRocket()) {
+        d->getRocket()->setThrustLevel(input.g);
+    }
+}
+
+void GameClient::interpolateRemotePlayers(float currentTime) {
+    // Skip if not fully connected
+    if (!k || j != ClientConnectionState::CONNECTED) {
+        return;
+    }
+
+    try {
+        // Where the server was i seconds ago, by our clock
+        float renderTime = currentTime + w - i;
+
+        for (auto a = h.begin(); a != h.end(); ) {
+            int b = a->first;
+            std::deque<RemoteSnapshot>& c = a->second.a;
+
+            auto d = this->c.find(b);
+            if (d == this->c.end() || !d->second || !d->second->getRocket()) {
+                // Remove stale state if player no longer exists
+                a = h.erase(a);
+                continue;
+            }
+
+            if (c.empty()) {
+                ++a;
+                continue;
+            }
+
+            // Snapshots both before the render time are done with
+            while (c.size() > 1 && c[1].e <= renderTime) {
+                c.pop_front();
+            }
+
+            RemoteSnapshot e;
+            if (renderTime <= c.front().e) {
+                // Too little history yet - hold at the oldest snapshot
+                e = c.front();
+            }
+            else if (c.size() > 1) {
+                e = hermite(c[0], c[1], renderTime);
+            }
+            else {
+                // Nothing newer arrived in time - coast for a bounded while, then wait
+                e = c.front();
+                e.a += e.b * std::min(renderTime - e.e, GameConstants::MAX_EXTRAPOLATION);
+            }
+
+            try {
+                Rocket* f = d->second->getRocket();
+                f->storePreviousPosition();
+                f->setPosition(e.a);
+                f->setVelocity(e.b);
+                f->setRotation(e.c);
+                f->setThrustLevel(e.d);
+            }
+            catch (const std::exception& a) {
+                std::cerr << "Exception in interpolateRemotePlayers: " << a.what() << std::endl;
+            }
+
+            ++a;
+        }
+    }
+    catch (const std::exception& a) {
+        std::cerr << "Exception in interpolateRemotePlayers: " << a.what() << std::endl;
+    }
 }
\ No newline at end of file
@@ -1,95 +1,123 @@
-// GameClient.h
-#pragma once
-#include "GravitySimulator.h"
-#include "VehicleManager.h"
-#include "GameState.h"
-#include "PlayerInput.h"
-#include <vector>
-#include <map>
-
-// Forward declaration for connection state
-enum class ClientConnectionState {
-    DISCONNECTED,
-    CONNECTING,
-    WAITING_FOR_ID,
-    WAITING_FOR_STATE,
-    CONNECTED
-};
-
-// Struct to store interpolation data for remote players
-struct RemotePlayerState {
-    sf::Vector2f a; // startPos
-    sf::Vector2f b; // startVel
-    sf::Vector2f c; // targetPos
-    sf::Vector2f d; // targetVel
-    float e; // rotation
-    float f; // timestamp
-};
-
-class GameClient {
-private:
-    GravitySimulator a; // simulator
-    std::vector<Planet*> b; // planets
-    std::map<int, VehicleManager*> c; // remotePlayers
-    VehicleManager* d; // localPlayer
-    int e; // localPlayerId
-
-    // Last received state for interpolation
-    GameState f; // lastState
-    float g; // stateTimestamp
-
-    // Interpolation data for remote players
-    std::map<int, RemotePlayerState> h; // remotePlayerStates
-    float i; // latencyCompensation - time window for interpolation
-
-    // Connection state tracking
-    ClientConnectionState j; // connectionState
-    bool k; // hasReceivedInitialState
-
-    // New members for distributed simulation
-    GameState l; // localSimulation - client's own simulation state
-    sf::Clock m; // simulationClock - time tracking for local simulation
-    float n; // simulationTime - current time in local simulation
-    bool o; // simulationPaused - whether local simulation is paused waiting for server
-    float p; // lastServerSyncTime - when server last validated our simulation
-    float q; // syncInterval - how often to send simulation to server
-    bool r; // pendingValidation - waiting for server validation
-
-public:
-    GameClient();
-    ~GameClient();
-    // Add to GameClient.h in the public section:
-    void initializeLocalSimulation();
-    void initialize();
-    void update(float deltaTime);
-    void processGameState(const GameState& state);
-    PlayerInput getLocalPlayerInput(float deltaTime) const;
-
-    // Apply input locally for responsive control
-    void applyLocalInput(const PlayerInput& input);
-
-    // Interpolate remote players between received states
-    void interpolateRemotePlayers(float currentTime);
-
-    // New methods for distributed simulation
-    void runLocalSimulation(float deltaTime);
-    void pauseSimulation() { o = true; }
-    void resumeSimulation() { o = false; }
-    GameState getLocalSimulation() const { return l; }
-    void processServerValidation(const GameState& validatedState);
-    void setSyncInterval(float interval) { q = interval; }
-
-    // Set latency compensation window
-    void setLatencyCompensation(float value);
-    void setLocalPlayerId(int id);
-    int getLocalPlayerId() const { return e; }
-
-    VehicleManager* getLocalPlayer() { return d; }
-    const std::vector<Planet*>& getPlanets() const { return b; }
-    const std::map<int, VehicleManager*>& getRemotePlayers() const { return c; }
-
-    // Connection state methods
-    bool isConnected() const { return j == ClientConnectionState::CONNECTED && k; }
-    bool isWaitingForState() const { return j == ClientConnectionState::WAITING_FOR_STATE; }
-    bool isPendingValidation() const { return r; }
+// GameClient.h
+#pragma once
+#include "GravitySimulator.h"
+#include "VehicleManager.h"
+#include "GameState.h"
+#include "PlayerInput.h"
+#include "EntityRegistry.h"
+#include <vector>
+#include <map>
+#include <deque>
+
+// Forward declaration for connection state
+enum class ClientConnectionState {
+    DISCONNECTED,
+    CONNECTING,
+    WAITING_FOR_ID,
+    WAITING_FOR_STATE,
+    CONNECTED
+};
+
+// One server snapshot of a remote rocket
+struct RemoteSnapshot {
+    sf::Vector2f a; // position
+    sf::Vector2f b; // velocity
+    float c; // rotation
+    float d; // thrustLevel
+    float e; // timestamp - server time of the state it came in
+};
+
+// Jitter buffer for one remote rocket. Snapshots are kept oldest first and
+// the rocket is drawn a fixed delay behind the server, so there is nearly
+// always a snapshot on either side of the time being drawn.
+struct RemotePlayerState {
+    std::deque<RemoteSnapshot> a; // snapshots
+};
+
+class GameClient {
+private:
+    GravitySimulator a; // simulator
+    std::vector<Planet*> b; // planets
+    std::map<int, VehicleManager*> c; // remotePlayers
+    VehicleManager* d; // localPlayer
+    int e; // localPlayerId
+
+    // Last received state for interpolation
+    GameState f; // lastState
+    float g; // stateTimestamp
+
+    // Interpolation data for remote players
+    std::map<int, RemotePlayerState> h; // remotePlayerStates
+    float i; // latencyCompensation - how far behind the server remote players are drawn
+
+    // Connection state tracking
+    ClientConnectionState j; // connectionState
+    bool k; // hasReceivedInitialState
+
+    // New members for distributed simulation
+    GameState l; // localSimulation - client's own simulation state
+    sf::Clock m; // simulationClock - time tracking for local simulation
+    float n; // simulationTime - current time in local simulation
+    bool o; // simulationPaused - whether local simulation is paused waiting for server
+    float p; // lastServerSyncTime - when server last validated our simulation
+    float q; // syncInterval - how often to send simulation to server
+    bool r; // pendingValidation - waiting for server validation
+
+    EntityRegistry s; // planetIds - server planet handles to our local planets
+
+    // Client prediction - our own inputs are applied at once and kept until
+    // a state from the server says it has applied them too
+    std::vector<PlayerInput> t; // inputHistory - ring buffer, an input lives in slot sequence % size
+    uint32_t u; // inputSequence - last sequence handed out
+    uint32_t v; // ackedInputSequence - newest input the server has applied
+
+    // Server clock estimate for remote interpolation
+    float w; // serverClockOffset - server time minus our simulation time, smoothed
+    bool x; // hasServerClockOffset
+
+    void fillPlanetState(PlanetState& state, const Planet* planet) const;
+    void removeUnseenPlanets(unsigned long sequence);
+    void applyInput(const PlayerInput& input);
+    void reconcile(const RocketState& serverState, uint32_t ackedSequence);
+
+public:
+    GameClient();
+    ~GameClient();
+    // Add to GameClient.h in the public section:
+    void initializeLocalSimulation();
+    void initialize();
+    void update(float deltaTime);
+    void processGameState(const GameState& state);
+    PlayerInput getLocalPlayerInput(float deltaTime) const;
+
+    // Apply input locally for responsive control. Numbers the input (sets
+    // input.l) and keeps it for replay, so send it after this.
+    void applyLocalInput(PlayerInput& input);
+
+    // Move remote players to where the server had them latencyCompensation
+    // seconds ago, interpolating between (or briefly past) their snapshots
+    void interpolateRemotePlayers(float currentTime);
+
+    // New methods for distributed simulation
+    void runLocalSimulation(float deltaTime);
+    void pauseSimulation() { o = true; }
+    void resumeSimulation() { o = false; }
+    GameState getLocalSimulation() const { return l; }
+    void processServerValidation(const GameState& validatedState);
+    void setSyncInterval(float interval) { q = interval; }
+
+    // Set how far behind the server remote players are drawn. More than two
+    // snapshot intervals rides out a late or lost state without extrapolating.
+    void setLatencyCompensation(float value);
+    void setLocalPlayerId(int id);
+    int getLocalPlayerId() const { return e; }
+
+    VehicleManager* getLocalPlayer() { return d; }
+    const std::vector<Planet*>& getPlanets() const { return b; }
+    const std::map<int, VehicleManager*>& getRemotePlayers() const { return c; }
+
+    // Connection state methods
+    bool isConnected() const { return j == ClientConnectionState::CONNECTED && k; }
+    bool isWaitingForState() const { return j == ClientConnectionState::WAITING_FOR_STATE; }
+    bool isPendingValidation() const { return r; }
 };
\ No newline at end of file
@@ -1,78 +1,130 @@
-// GameConstants.h
-#pragma once
-#include <cmath>
-namespace GameConstants {
-    // Gravitational constants
-    constexpr float G = 100.0f;  // Gravitational constant
-    constexpr float PI = 3.14159265358979323846f;
-
-    // Mass-radius relationship constants
-    constexpr float BASE_RADIUS_FACTOR = 300.0f;  // Base size factor for planets
-    constexpr float REFERENCE_MASS = 100000.0f;  // Reference mass for radius scaling
-
-    // Primary inputs
-    constexpr float MAIN_PLANET_MASS = 100000.0f;  // Primary parameter to adjust
-    constexpr float ORBIT_PERIOD = 420.0f;  // Desired orbit period in seconds
-
-    // Derived parameters
-    constexpr float SECONDARY_PLANET_MASS = MAIN_PLANET_MASS * 0.06f;  // 8% of main planet mass
-
-    // Fixed radius values (not using functions that would cause constexpr issues)
-    constexpr float MAIN_PLANET_RADIUS = 100000.0f;  // Base radius at this mass
-    constexpr float MASS_RATIO = 0.06f;  // Same as SECONDARY_PLANET_MASS / MAIN_PLANET_MASS
-    constexpr float CUBE_ROOT_APPROX = 60.0f;  // Approximate cube root of 0.08
-    constexpr float SECONDARY_PLANET_RADIUS = (MAIN_PLANET_RADIUS / CUBE_ROOT_APPROX) / 10000;  // ~430
-
-    // Planet positions
-    constexpr float MAIN_PLANET_X = 400.0f;
-    constexpr float MAIN_PLANET_Y = 300.0f;
-
-    // Non-constexpr calculations for orbital parameters
-    const float PLANET_ORBIT_DISTANCE = std::pow((G * MAIN_PLANET_MASS * ORBIT_PERIOD * ORBIT_PERIOD) / (4.0f * PI * PI), 1.0f / 3.0f);
-
-    // Secondary planet position based on orbital distance
-    const float SECONDARY_PLANET_X = MAIN_PLANET_X + PLANET_ORBIT_DISTANCE;
-    const float SECONDARY_PLANET_Y = MAIN_PLANET_Y;
-
-    // Pre-calculate orbital velocity for a circular orbit
-    const float SECONDARY_PLANET_ORBITAL_VELOCITY =
-        std::sqrt(G * MAIN_PLANET_MASS / PLANET_ORBIT_DISTANCE);
-
-    // Rocket parameters
-    constexpr float ROCKET_MASS = 1.0f;
-    constexpr float ROCKET_SIZE = 15.0f;
-
-    // Visualization settings
-    constexpr float GRAVITY_VECTOR_SCALE = 100.0f;
-    constexpr float VELOCITY_VECTOR_SCALE = 0.01f;
-
-    // Trajectory calculation settings
-    constexpr float TRAJECTORY_TIME_STEP = 0.05f;
-    constexpr int TRAJECTORY_STEPS = 5000;
-    constexpr float TRAJECTORY_COLLISION_RADIUS = 12.0f;
-
-    // Vehicle physics
-    constexpr float FRICTION = 0.98f;  // Friction coefficient for surface movement (adjusted)
-    constexpr float TRANSFORM_DISTANCE = 40.0f;  // Distance for vehicle transformation (increased)
-    constexpr float CAR_WHEEL_RADIUS = 5.0f;  // Radius of car wheels
-    constexpr float CAR_BODY_WIDTH = 30.0f;  // Width of car body
-    constexpr float CAR_BODY_HEIGHT = 15.0f;  // Height of car body
-
-    // Engine parameters - scaled with gravitational constant
-    constexpr float BASE_THRUST_MULTIPLIER = 1.875f;
-    constexpr float ENGINE_THRUST_POWER = G * BASE_THRUST_MULTIPLIER;
-
-    // Vehicle transformation parameters
-    constexpr float TRANSFORM_VELOCITY_FACTOR = 0.1f;  // Velocity reduction when transforming from rocket to car
-
-    // Fuel constants
-    constexpr float BASE_FUEL_CONSUMPTION_RATE = 0.5f;  // Units of fuel consumed per second at full thrust
-    constexpr float FUEL_EFFICIENCY_MULTIPLIER = 0.01f;   // Higher values mean more efficient engines
-
-    // Fuel transfer distance limit
-    constexpr float FUEL_TRANSFER_DISTANCE = 100.0f;  // Maximum distance to transfer fuel between rocket and planet
-
-    // Fuel transfer rate
-    constexpr float FUEL_TRANSFER_AMOUNT = 0.25f;  // Amount of fuel transferred per tick
-
+// GameConstants.h
+#pragma once
+#include <cmath>
+#include <cstddef>
+namespace GameConstants {
+    // Gravitational constants
+    constexpr float G = 100.0f;  // Gravitational constant
+    constexpr float PI = 3.14159265358979323846f;
+
+    // Mass-radius relationship constants
+    constexpr float BASE_RADIUS_FACTOR = 300.0f;  // Base size factor for planets
+    constexpr float REFERENCE_MASS = 100000.0f;  // Reference mass for radius scaling
+
+    // Primary inputs
+    constexpr float MAIN_PLANET_MASS = 100000.0f;  // Primary parameter to adjust
+    constexpr float ORBIT_PERIOD = 420.0f;  // Desired orbit period in seconds
+
+    // Derived parameters
+    constexpr float SECONDARY_PLANET_MASS = MAIN_PLANET_MASS * 0.06f;  // 8% of main planet mass
+
+    // Fixed radius values (not using functions that would cause constexpr issues)
+    constexpr float MAIN_PLANET_RADIUS = 100000.0f;  // Base radius at this mass
+    constexpr float MASS_RATIO = 0.06f;  // Same as SECONDARY_PLANET_MASS / MAIN_PLANET_MASS
+    constexpr float CUBE_ROOT_APPROX = 60.0f;  // Approximate cube root of 0.08
+    constexpr float SECONDARY_PLANET_RADIUS = (MAIN_PLANET_RADIUS / CUBE_ROOT_APPROX) / 10000;  // ~430
+
+    // Planet positions
+    constexpr float MAIN_PLANET_X = 400.0f;
+    constexpr float MAIN_PLANET_Y = 300.0f;
+
+    // Non-constexpr calculations for orbital parameters
+    const float PLANET_ORBIT_DISTANCE = std::pow((G * MAIN_PLANET_MASS * ORBIT_PERIOD * ORBIT_PERIOD) / (4.0f * PI * PI), 1.0f / 3.0f);
+
+    // Secondary planet position based on orbital distance
+    const float SECONDARY_PLANET_X = MAIN_PLANET_X + PLANET_ORBIT_DISTANCE;
+    const float SECONDARY_PLANET_Y = MAIN_PLANET_Y;
+
+    // Pre-calculate orbital velocity for a circular orbit
+    const float SECONDARY_PLANET_ORBITAL_VELOCITY =
+        std::sqrt(G * MAIN_PLANET_MASS / PLANET_ORBIT_DISTANCE);
+
+    // Rocket parameters
+    constexpr float ROCKET_MASS = 1.0f;
+    constexpr float ROCKET_SIZE = 15.0f;
+
+    // Visualization settings
+    constexpr float GRAVITY_VECTOR_SCALE = 100.0f;
+    constexpr float VELOCITY_VECTOR_SCALE = 0.01f;
+
+    // Trajectory calculation settings
+    constexpr float TRAJECTORY_TIME_STEP = 0.05f;
+    constexpr int TRAJECTORY_STEPS = 5000;
+    constexpr float TRAJECTORY_COLLISION_RADIUS = 12.0f;
+    constexpr float TRAJECTORY_CACHE_MAX_AGE = 2.0f;  // Seconds of cached prediction consumed before a full rebuild
+    constexpr float TRAJECTORY_CACHE_TOLERANCE = 5.0f;  // Extra drift from the cached path allowed before a rebuild
+    constexpr float TRAJECTORY_PIXEL_TOLERANCE = 0.5f;  // On-screen error allowed in predicted paths, in pixels
+    constexpr float TRAJECTORY_MAX_STEP_SCALE = 40.0f;  // Longest adaptive step, as a multiple of the nominal time step
+    constexpr float KEPLER_SOI_FRACTION = 0.9f;  // Conic fast path only starts this deep inside a sphere of influence
+    constexpr float KEPLER_MAX_PERTURBATION = 0.01f;  // ...and when other planets pull less than this fraction of the dominant one
+
+    // Barnes-Hut gravity settings
+    constexpr float BARNES_HUT_THETA = 0.5f;  // Opening angle - 0 is exact, larger is faster but less accurate
+    constexpr size_t BARNES_HUT_MIN_BODIES = 64;  // Below this many planets the exact pairwise loop is cheaper
+
+    // Fixed-step physics loop
+    constexpr float PHYSICS_TICK_RATE = 60.0f;  // Physics steps per second - clients and server must agree
+    constexpr int PHYSICS_MAX_SUBSTEPS = 8;  // Most physics steps run in one frame before time is dropped
+    constexpr float MAX_FRAME_TIME = 0.25f;  // Longer frames (window drags, breakpoints) are clamped to this
+
+    // Floating origin
+    constexpr float FLOATING_ORIGIN_DISTANCE = 4096.0f;  // Rebase the world once the tracked vehicle is this far from (0, 0)
+
+    // Gravity worker threads
+    constexpr size_t GRAVITY_WORKER_THREADS = 0;  // Threads for the force step, including the caller - 0 uses every hardware thread, started once a simulator reaches GRAVITY_PARALLEL_MIN_BODIES
+    constexpr size_t GRAVITY_PARALLEL_MIN_BODIES = 256;  // Below this many planets waking the workers costs more than it saves
+
+    // Server broadcast
+    constexpr float SNAPSHOT_RATE = 20.0f;  // Game states sent to each client per second, independent of PHYSICS_TICK_RATE
+    constexpr size_t SEND_QUEUE_MAX_PACKETS = 256;  // Reliable messages queued for one socket before its peer is dropped
+    constexpr size_t SEND_QUEUE_MAX_BYTES = 1024 * 1024;  // ...or this many bytes
+
+    // Network thread
+    constexpr size_t NETWORK_QUEUE_CAPACITY = 4096;  // Messages in flight each way between the game and network threads
+    constexpr float NETWORK_WAIT_TIMEOUT = 0.1f;  // Longest the network thread sleeps with nothing to do - send() and receive() wake it sooner
+
+    // Client prediction
+    constexpr size_t PREDICTION_INPUT_BUFFER = 256;  // Inputs kept for replay until the server applies them - about 4 s at PHYSICS_TICK_RATE
+    constexpr size_t SERVER_INPUT_BUFFER = 8;  // Inputs the server queues per player, one is applied each tick - older ones are dropped past this
+    constexpr float PREDICTION_CORRECTION_EPSILON = 0.5f;  // Replayed positions this close to the prediction keep the prediction
+    constexpr float VALIDATION_THRESHOLD = 50.0f;  // Position error the server allows a client's own simulation before correcting it
+
+    // Remote player interpolation
+    constexpr float INTERPOLATION_DELAY = 0.1f;  // Remote rockets are drawn this far behind the server - keep it at two snapshot intervals or more
+    constexpr float MAX_EXTRAPOLATION = 0.25f;  // Longest a remote rocket keeps coasting on its last velocity when snapshots stop coming
+    constexpr size_t REMOTE_SNAPSHOT_BUFFER = 32;  // Snapshots kept per remote rocket
+    constexpr float SERVER_CLOCK_SMOOTHING = 0.05f;  // How quickly the estimate of the server clock follows each new state
+    constexpr float SERVER_CLOCK_RESYNC = 0.5f;  // ...it jumps straight to a state this far off instead
+
+    // Per-client interest management
+    constexpr float INTEREST_RADIUS = 10000.0f;  // Other rockets further than this from a player are left out of its states
+    constexpr float INTEREST_NEAR_DISTANCE = 1500.0f;  // Bodies this close gain a full refresh worth of priority every state
+    constexpr float INTEREST_SPEED_REFERENCE = 100.0f;  // Relative speed that doubles a body's priority
+    constexpr size_t INTEREST_MAX_REFRESH = 24;  // Nearby bodies sent with current values per state
+    constexpr size_t INTEREST_BACKGROUND_REFRESH = 2;  // Planets outside the radius refreshed per state, round robin
+
+    // Vehicle physics
+    constexpr float FRICTION = 0.98f;  // Friction coefficient for surface movement (adjusted)
+    constexpr float TRANSFORM_DISTANCE = 40.0f;  // Distance for vehicle transformation (increased)
+    constexpr float CAR_WHEEL_RADIUS = 5.0f;  // Radius of car wheels
+    constexpr float CAR_BODY_WIDTH = 30.0f;  // Width of car body
+    constexpr float CAR_BODY_HEIGHT = 15.0f;  // Height of car body
+
+    // Engine parameters - scaled with gravitational constant
+    constexpr float BASE_THRUST_MULTIPLIER = 1.875f;
+    constexpr float ENGINE_THRUST_POWER = G * BASE_THRUST_MULTIPLIER;
+
+    // Vehicle transformation parameters
+    constexpr float TRANSFORM_VELOCITY_FACTOR = 0.1f;  // Velocity reduction when transforming from rocket to car
+
+    // Fuel constants
+    constexpr float BASE_FUEL_CONSUMPTION_RATE = 0.5f;  // Units of fuel consumed per second at full thrust
+    constexpr float FUEL_EFFICIENCY_MULTIPLIER = 0.01f;   // Higher values mean more efficient engines
+
+    // Fuel transfer distance limit
+    constexpr float FUEL_TRANSFER_DISTANCE = 100.0f;  // Maximum distance to transfer fuel between rocket and planet
+
+    // Fuel transfer rate
+    constexpr float FUEL_TRANSFER_AMOUNT = 0.25f;  // Amount of fuel transferred per tick
+
 }
\ No newline at end of file
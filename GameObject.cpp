@@ -1,21 +1,33 @@
-#include "GameObject.h"
-
-GameObject::GameObject(sf::Vector2f pos, sf::Vector2f vel, sf::Color col)
-    : position(pos), velocity(vel), color(col)
-{
-}
-
-sf::Vector2f GameObject::getPosition() const
-{
-    return position;
-}
-
-sf::Vector2f GameObject::getVelocity() const
-{
-    return velocity;
-}
-
-void GameObject::setVelocity(sf::Vector2f vel)
-{
-    velocity = vel;
+#include "GameObject.h"
+
+GameObject::GameObject(sf::Vector2f pos, sf::Vector2f vel, sf::Color col)
+    : position(pos), velocity(vel), color(col), previousPosition(pos), renderAlpha(1.0f)
+{
+}
+
+sf::Vector2f GameObject::getPosition() const
+{
+    return position;
+}
+
+sf::Vector2f GameObject::getVelocity() const
+{
+    return velocity;
+}
+
+void GameObject::setVelocity(sf::Vector2f vel)
+{
+    velocity = vel;
+}
+
+void GameObject::shiftOrigin(sf::Vector2f offset)
+{
+    // Shift both physics states so render interpolation does not see a jump
+    position -= offset;
+    previousPosition -= offset;
+}
+
+sf::Vector2f GameObject::getRenderPosition() const
+{
+    return previousPosition + (position - previousPosition) * renderAlpha;
 }
\ No newline at end of file
@@ -1,20 +1,40 @@
-#pragma once
-#include <SFML/Graphics.hpp>
-
-class GameObject {
-protected:
-    sf::Vector2f position;
-    sf::Vector2f velocity;
-    sf::Color color;
-
-public:
-    GameObject(sf::Vector2f pos, sf::Vector2f vel, sf::Color col);
-    virtual ~GameObject() = default;
-
-    virtual void update(float deltaTime) = 0;
-    virtual void draw(sf::RenderWindow& window) = 0;
-
-    sf::Vector2f getPosition() const;
-    sf::Vector2f getVelocity() const;
-    void setVelocity(sf::Vector2f vel);
+#pragma once
+#include <SFML/System/Vector2.hpp>
+#include <SFML/Graphics/Color.hpp>
+#ifndef HEADLESS_SERVER
+#include <SFML/Graphics.hpp>
+#endif
+
+// HEADLESS_SERVER builds (the dedicated server) compile the simulation without
+// any drawable state: shapes and draw functions are left out, and shapes are
+// only brought in line with the simulation when they are drawn.
+
+class GameObject {
+protected:
+    sf::Vector2f position;
+    sf::Vector2f velocity;
+    sf::Color color;
+    sf::Vector2f previousPosition;  // Position before the last physics step
+    float renderAlpha;  // How far rendering is between previousPosition and position
+
+public:
+    GameObject(sf::Vector2f pos, sf::Vector2f vel, sf::Color col);
+    virtual ~GameObject() = default;
+
+    virtual void update(float deltaTime) = 0;
+#ifndef HEADLESS_SERVER
+    virtual void draw(sf::RenderWindow& window) = 0;
+#endif
+
+    sf::Vector2f getPosition() const;
+    sf::Vector2f getVelocity() const;
+    void setVelocity(sf::Vector2f vel);
+
+    // Render interpolation - physics runs at a fixed rate, frames fall in between
+    void storePreviousPosition() { previousPosition = position; }
+    void setRenderAlpha(float alpha) { renderAlpha = alpha; }
+    sf::Vector2f getRenderPosition() const;
+
+    // Floating origin - the world was moved by -offset, follow it
+    virtual void shiftOrigin(sf::Vector2f offset);
 };
\ No newline at end of file
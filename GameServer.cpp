@@ -1,382 +1,454 @@
-// GameServer.cpp
-#include "GameServer.h"
-#include "GameConstants.h"
-#include <iostream> 
-
-GameServer::GameServer() : d(0), e(0.0f), i(0.1f) {
-}
-
-GameServer::~GameServer() {
-    // Clean up players
-    for (auto& a : c) {
-        delete a.second;
-    }
-    c.clear();
-
-    // Clean up planets
-    for (auto& a : b) {
-        delete a;
-    }
-    b.clear();
-}void GameServer::initialize() {
-    // Create main planet (sun)
-    Planet* mainPlanet = new Planet(
-        sf::Vector2f(GameConstants::MAIN_PLANET_X, GameConstants::MAIN_PLANET_Y),
-        0, GameConstants::MAIN_PLANET_MASS, sf::Color::Yellow);
-    mainPlanet->setVelocity(sf::Vector2f(1.f, -1.f));
-    b.push_back(mainPlanet);
-
-    // Create 9 orbiting planets with different orbital distances, sizes, and colors
-    const float baseMass = GameConstants::SECONDARY_PLANET_MASS;
-    const sf::Color planetColors[] = {
-        sf::Color(150, 150, 150),   // Mercury (gray)
-        sf::Color(255, 190, 120),   // Venus (light orange)
-        sf::Color(0, 100, 255),     // Earth (blue)
-        sf::Color(255, 100, 0),     // Mars (red)
-        sf::Color(255, 200, 100),   // Jupiter (light orange)
-        sf::Color(230, 180, 80),    // Saturn (tan)
-        sf::Color(180, 230, 230),   // Uranus (light blue)
-        sf::Color(100, 130, 255),   // Neptune (dark blue)
-        sf::Color(230, 230, 230)    // Pluto (light gray)
-    };
-
-    // Distance and mass scaling factors
-    const float distanceFactors[] = { 0.4f, 0.7f, 1.0f, 1.5f, 2.2f, 3.0f, 4.0f, 5.0f, 6.0f };
-    const float massFactors[] = { 0.1f, 0.8f, 1.0f, 0.5f, 11.0f, 9.5f, 4.0f, 3.8f, 0.05f };
-
-    // Create each planet
-    for (int i = 0; i < 9; i++) {
-        float orbitDistance = GameConstants::PLANET_ORBIT_DISTANCE * distanceFactors[i];
-        float angle = (i * 40.0f) * (3.14159f / 180.0f); // Distribute planets around the sun
-
-        // Calculate position based on orbit distance and angle
-        float posX = mainPlanet->getPosition().x + orbitDistance * cos(angle);
-        float posY = mainPlanet->getPosition().y + orbitDistance * sin(angle);
-
-        // Calculate orbital velocity for a circular orbit
-        float orbitalVelocity = std::sqrt(GameConstants::G * mainPlanet->getMass() / orbitDistance);
-
-        // Velocity is perpendicular to position vector
-        float velX = -sin(angle) * orbitalVelocity;
-        float velY = cos(angle) * orbitalVelocity;
-
-        // Create the planet with scaled mass
-        Planet* newPlanet = new Planet(
-            sf::Vector2f(posX, posY),
-            0, baseMass * massFactors[i], planetColors[i]);
-
-        newPlanet->setVelocity(sf::Vector2f(velX, velY));
-        b.push_back(newPlanet);
-    }
-
-    // Setup gravity simulator
-    this->a.setSimulatePlanetGravity(true);
-    for (auto planet : b) {
-        this->a.addPlanet(planet);
-    }
-
-    // Create a default host player (ID 0)
-    sf::Vector2f spawnPos = b[0]->getPosition() +
-        sf::Vector2f(0, -(b[0]->getRadius() + GameConstants::ROCKET_SIZE));
-    addPlayer(0, spawnPos, sf::Color::White);
-}
-
-int GameServer::addPlayer(int playerId, sf::Vector2f initialPos, sf::Color color) {
-    // Check if player already exists
-    if (c.find(playerId) != c.end()) {
-        return playerId; // Player already exists
-    }
-
-    try {
-        // Create a new vehicle manager for this player
-        VehicleManager* a = new VehicleManager(initialPos, b, playerId);
-
-        // Make sure rocket was initialized properly
-        if (a && a->getRocket()) {
-            a->getRocket()->setColor(color);
-
-            // Add to simulator
-            this->a.addVehicleManager(a);
-
-            // Store in players map
-            c[playerId] = a;
-
-            // Initialize client simulation tracking
-            f[playerId] = GameState();
-            g[playerId] = e; // Current game time
-            h[playerId] = true; // Initially valid
-
-            std::cout << "Added player with ID: " << playerId << std::endl;
-        }
-        else {
-            std::cerr << "Failed to initialize rocket for player ID: " << playerId << std::endl;
-            delete a; // Clean up if rocket initialization failed
-        }
-    }
-    catch (const std::exception& a) {
-        std::cerr << "Exception when adding player ID " << playerId << ": " << a.what() << std::endl;
-    }
-
-    return playerId;
-}
-
-void GameServer::removePlayer(int playerId) {
-    auto a = c.find(playerId);
-    if (a != c.end()) {
-        this->a.removeVehicleManager(a->second);
-        delete a->second;
-        c.erase(a);
-
-        // Also remove from client simulation tracking
-        f.erase(playerId);
-        g.erase(playerId);
-        h.erase(playerId);
-    }
-}
-
-void GameServer::update(float deltaTime) {
-    // Update game time
-    e += deltaTime;
-
-    // Update simulator for server-owned objects
-    a.update(deltaTime);
-
-    // Update planets
-    for (auto a : b) {
-        a->update(deltaTime);
-    }
-
-    // Update all players
-    for (auto& a : c) {
-        if (a.second) { // Add null check before updating
-            a.second->update(deltaTime);
-        }
-    }
-
-    // Increment sequence number
-    d++;
-
-    // Synchronize client and server states periodically
-    synchronizeState();
-}
-
-void GameServer::handlePlayerInput(int playerId, const PlayerInput& input) {
-    auto a = c.find(playerId);
-    if (a == c.end()) {
-        // Player not found - could be a new connection, create player
-        std::cout << "Unknown player ID: " << playerId << ", creating new player" << std::endl;
-        sf::Vector2f b = this->b[0]->getPosition() +
-            sf::Vector2f(0, -(this->b[0]->getRadius() + GameConstants::ROCKET_SIZE));
-
-        // Add the player with error handling
-        VehicleManager* c = new VehicleManager(b, this->b, playerId);
-        if (c && c->getRocket()) {
-            this->c[playerId] = c;
-            this->a.addVehicleManager(c);
-
-            // Initialize client simulation tracking
-            f[playerId] = GameState();
-            g[playerId] = e; // Current game time
-            h[playerId] = true; // Initially valid
-        }
-        else {
-            std::cerr << "Failed to create player for ID: " << playerId << std::endl;
-            delete c;
-        }
-        return;
-    }
-
-    // Debug output
-    std::cout << "Server applying input to player ID: " << playerId << std::endl;
-
-    // Update client state tracking
-    if (input.j > g[playerId]) {
-        g[playerId] = input.j; // Update last client update time
-    }
-
-    // Get client's rocket state if provided
-    if (input.k.j) { // If this is authoritative from client
-        // Store the client's rocket state
-        f[playerId].c.clear();
-        f[playerId].c.push_back(input.k);
-
-        // Mark client simulation as valid
-        h[playerId] = true;
-    }
-
-    // Apply input to the correct player's vehicle manager
-    VehicleManager* b = a->second;
-    if (!b) return; // Add null check
-
-    // Apply input to the vehicle
-    if (input.b) {
-        b->applyThrust(1.0f);
-    }
-    if (input.c) {
-        b->applyThrust(-0.5f);
-    }
-    if (input.d) {
-        b->rotate(-6.0f * input.h * 60.0f);
-    }
-    if (input.e) {
-        b->rotate(6.0f * input.h * 60.0f);
-    }
-    if (input.f) {
-        b->switchVehicle();
-    }
-
-    // Apply thrust level with null checking
-    if (b->getActiveVehicleType() == VehicleType::ROCKET && b->getRocket()) {
-        b->getRocket()->setThrustLevel(input.g);
-    }
-}
-
-void GameServer::processClientSimulation(int playerId, const GameState& clientState) {
-    // Store the client's latest state
-    f[playerId] = clientState;
-    g[playerId] = clientState.b; // Update timestamp
-
-    // Validate the client simulation
-    GameState a = validateClientSimulation(playerId, clientState);
-
-    // If validation changed something, send back the corrected state
-    if (!h[playerId]) {
-        // TODO: Send validation state back to client
-    }
-}
-
-GameState GameServer::validateClientSimulation(int playerId, const GameState& clientState) {
-    GameState a = clientState;
-    bool b = true;
-
-    // Get server's state for this player
-    VehicleManager* c = getPlayer(playerId);
-    if (!c || !c->getRocket()) {
-        h[playerId] = false;
-        return a;
-    }
-
-    // Compare key values between client and server rocket states
-    if (!clientState.c.empty()) {
-        const RocketState& d = clientState.c[0];
-
-        // Create current server rocket state
-        RocketState e;
-        c->createState(e);
-
-        // Check position difference
-        sf::Vector2f f = d.b - e.b;
-        float g = std::sqrt(f.x * f.x + f.y * f.y);
-
-        // Check velocity difference
-        sf::Vector2f h = d.c - e.c;
-        float j = std::sqrt(h.x * h.x + h.y * h.y);
-
-        // If difference exceeds threshold, client simulation is invalid
-        if (g > i || j > i * 10.0f) {
-            b = false;
-
-            // Update the client state with server state
-            a.c.clear();
-            a.c.push_back(e);
-        }
-    }
-
-    // Update validation status
-    this->h[playerId] = b;
-
-    return a;
-}
-
-void GameServer::synchronizeState() {
-    // For each player, check if their simulation is valid
-    for (auto& a : c) {
-        int b = a.first;
-
-        // Skip validation for server player (ID 0)
-        if (b == 0) continue;
-
-        // Get server's state for this player
-        if (f.find(b) != f.end() && h.find(b) != h.find(b)) {
-            // Check if client simulation is valid
-            if (!h[b]) {
-                // Client simulation invalid - next update will send correction
-                continue;
-            }
-
-            // Check time since last update
-            float c = e - g[b];
-            if (c > 5.0f) {
-                // Too long since last update, mark invalid
-                h[b] = false;
-            }
-        }
-    }
-}
-
-GameState GameServer::getGameState() const {
-    GameState a;
-    a.a = d;
-    a.b = e;
-    a.e = false; // Not initial state by default
-
-    try {
-        // Add all rockets
-        for (const auto& b : c) {
-            int c = b.first;
-            const VehicleManager* d = b.second;
-
-            // Add null checks
-            if (!d) continue;
-
-            // Only add if it's a rocket
-            if (d->getActiveVehicleType() == VehicleType::ROCKET) {
-                const Rocket* e = d->getRocket();
-
-                // Add null check for rocket
-                if (!e) continue;
-
-                RocketState f;
-                f.a = c;  // playerId
-                f.b = e->getPosition();  // position
-                f.c = e->getVelocity();  // velocity
-                f.d = e->getRotation();  // rotation
-                f.e = 0.0f;  // angularVelocity - not tracked in current design
-                f.f = e->getThrustLevel();  // thrustLevel
-                f.g = e->getMass();  // mass
-                f.h = e->getColor();  // color
-                f.i = this->e;  // current server timestamp
-                f.j = true;  // Server state is authoritative
-
-                a.c.push_back(f);
-            }
-            // TODO: Add car state if needed
-        }
-
-        // Add all planets
-        for (size_t b = 0; b < this->b.size(); ++b) {
-            const Planet* c = this->b[b];
-
-            // Skip null planets
-            if (!c) continue;
-
-            PlanetState d;
-            d.a = static_cast<int>(b);  // planetId
-            d.b = c->getPosition();  // position
-            d.c = c->getVelocity();  // velocity
-            d.d = c->getMass();  // mass
-            d.e = c->getRadius();  // radius
-            d.f = c->getColor();  // color
-            d.g = c->getOwnerId();  // ownerId
-            d.h = this->e;  // timestamp
-
-            a.d.push_back(d);
-        }
-    }
-    catch (const std::exception& b) {
-        std::cerr << "Exception in getGameState: " << b.what() << std::endl;
-        // Return a minimal valid state to avoid crashes
-    }
-
-    return a;
+// GameServer.cpp
+#include "GameServer.h"
+#include "GameConstants.h"
+#include "PlanetPool.h"
+#include <iostream> 
+
+GameServer::GameServer() : d(0), e(0.0f), i(GameConstants::VALIDATION_THRESHOLD), k(-1) {
+}
+
+GameServer::~GameServer() {
+    // Clean up players
+    for (auto& a : c) {
+        delete a.second;
+    }
+    c.clear();
+
+    // Clean up planets
+    for (auto& a : b) {
+        PlanetPool::getInstance().destroy(a);
+    }
+    b.clear();
+}void GameServer::initialize() {
+    // Create main planet (sun)
+    Planet* mainPlanet = PlanetPool::getInstance().create(
+        sf::Vector2f(GameConstants::MAIN_PLANET_X, GameConstants::MAIN_PLANET_Y),
+        0, GameConstants::MAIN_PLANET_MASS, sf::Color::Yellow);
+    mainPlanet->setVelocity(sf::Vector2f(1.f, -1.f));
+    b.push_back(mainPlanet);
+
+    // Create 9 orbiting planets with different orbital distances, sizes, and colors
+    const float baseMass = GameConstants::SECONDARY_PLANET_MASS;
+    const sf::Color planetColors[] = {
+        sf::Color(150, 150, 150),   // Mercury (gray)
+        sf::Color(255, 190, 120),   // Venus (light orange)
+        sf::Color(0, 100, 255),     // Earth (blue)
+        sf::Color(255, 100, 0),     // Mars (red)
+        sf::Color(255, 200, 100),   // Jupiter (light orange)
+        sf::Color(230, 180, 80),    // Saturn (tan)
+        sf::Color(180, 230, 230),   // Uranus (light blue)
+        sf::Color(100, 130, 255),   // Neptune (dark blue)
+        sf::Color(230, 230, 230)    // Pluto (light gray)
+    };
+
+    // Distance and mass scaling factors
+    const float distanceFactors[] = { 0.4f, 0.7f, 1.0f, 1.5f, 2.2f, 3.0f, 4.0f, 5.0f, 6.0f };
+    const float massFactors[] = { 0.1f, 0.8f, 1.0f, 0.5f, 11.0f, 9.5f, 4.0f, 3.8f, 0.05f };
+
+    // Create each planet
+    for (int i = 0; i < 9; i++) {
+        float orbitDistance = GameConstants::PLANET_ORBIT_DISTANCE * distanceFactors[i];
+        float angle = (i * 40.0f) * (3.14159f / 180.0f); // Distribute planets around the sun
+
+        // Calculate position based on orbit distance and angle
+        float posX = mainPlanet->getPosition().x + orbitDistance * cos(angle);
+        float posY = mainPlanet->getPosition().y + orbitDistance * sin(angle);
+
+        // Calculate orbital velocity for a circular orbit
+        float orbitalVelocity = std::sqrt(GameConstants::G * mainPlanet->getMass() / orbitDistance);
+
+        // Velocity is perpendicular to position vector
+        float velX = -sin(angle) * orbitalVelocity;
+        float velY = cos(angle) * orbitalVelocity;
+
+        // Create the planet with scaled mass
+        Planet* newPlanet = PlanetPool::getInstance().create(
+            sf::Vector2f(posX, posY),
+            0, baseMass * massFactors[i], planetColors[i]);
+
+        newPlanet->setVelocity(sf::Vector2f(velX, velY));
+        b.push_back(newPlanet);
+    }
+
+    // Setup gravity simulator
+    this->a.setSimulatePlanetGravity(true);
+    for (auto planet : b) {
+        this->a.addPlanet(planet);
+    }
+
+    // Create a default host player (ID 0)
+    sf::Vector2f spawnPos = b[0]->getPosition() +
+        sf::Vector2f(0, -(b[0]->getRadius() + GameConstants::ROCKET_SIZE));
+    addPlayer(0, spawnPos, sf::Color::White);
+}
+
+int GameServer::addPlayer(int playerId, sf::Vector2f initialPos, sf::Color color) {
+    // Check if player already exists
+    if (c.find(playerId) != c.end()) {
+        return playerId; // Player already exists
+    }
+
+    try {
+        // Create a new vehicle manager for this player
+        VehicleManager* a = new VehicleManager(initialPos, b, playerId);
+
+        // Make sure rocket was initialized properly
+        if (a && a->getRocket()) {
+            a->getRocket()->setColor(color);
+
+            // Store in players map
+            c[playerId] = a;
+
+            // Initialize client simulation tracking
+            f[playerId] = GameState();
+            g[playerId] = e; // Current game time
+            h[playerId] = true; // Initially valid
+
+            std::cout << "Added player with ID: " << playerId << std::endl;
+        }
+        else {
+            std::cerr << "Failed to initialize rocket for player ID: " << playerId << std::endl;
+            delete a; // Clean up if rocket initialization failed
+        }
+    }
+    catch (const std::exception& a) {
+        std::cerr << "Exception when adding player ID " << playerId << ": " << a.what() << std::endl;
+    }
+
+    return playerId;
+}
+
+void GameServer::removePlayer(int playerId) {
+    auto a = c.find(playerId);
+    if (a != c.end()) {
+        delete a->second;
+        c.erase(a);
+
+        // Also remove from client simulation tracking
+        f.erase(playerId);
+        g.erase(playerId);
+        h.erase(playerId);
+        j.removeClient(playerId);
+        l.erase(playerId);
+        m.erase(playerId);
+    }
+}
+
+void GameServer::update(float deltaTime) {
+    // Update game time
+    e += deltaTime;
+
+    // One input per player per tick - the client replays its unacked inputs
+    // as input, gravity, step, and this has to take the same steps
+    applyQueuedInputs();
+
+    // Players are not the simulator's vehicle - every rocket is pulled
+    // towards the planets where they are at the start of the tick
+    a.beginReplay();
+
+    // Update simulator for server-owned objects
+    a.update(deltaTime);
+
+    // Merges may have destroyed planets - the simulator's list is the live one
+    bool planetsChanged = b != a.getPlanets();
+    b = a.getPlanets();
+
+    // Update planets
+    for (auto a : b) {
+        a->update(deltaTime);
+    }
+
+    // Update all players
+    for (auto& a : c) {
+        VehicleManager* b = a.second;
+        if (!b) continue; // Add null check before updating
+
+        if (planetsChanged) {
+            b->updatePlanets(this->b);
+        }
+        if (GameObject* c = b->getActiveVehicle()) {
+            c->storePreviousPosition();
+        }
+        if (b->getActiveVehicleType() == VehicleType::ROCKET) {
+            this->a.applyGravityToRocket(b->getRocket(), deltaTime);
+        }
+        b->update(deltaTime);
+    }
+
+    // Increment sequence number
+    d++;
+
+    // Synchronize client and server states periodically
+    synchronizeState();
+}
+
+void GameServer::handlePlayerInput(int playerId, const PlayerInput& input) {
+    auto a = c.find(playerId);
+    if (a == c.end()) {
+        // Player not found - could be a new connection, create player
+        std::cout << "Unknown player ID: " << playerId << ", creating new player" << std::endl;
+        sf::Vector2f b = this->b[0]->getPosition() +
+            sf::Vector2f(0, -(this->b[0]->getRadius() + GameConstants::ROCKET_SIZE));
+
+        // Add the player with error handling
+        VehicleManager* c = new VehicleManager(b, this->b, playerId);
+        if (c && c->getRocket()) {
+            this->c[playerId] = c;
+
+            // Initialize client simulation tracking
+            f[playerId] = GameState();
+            g[playerId] = e; // Current game time
+            h[playerId] = true; // Initially valid
+        }
+        else {
+            std::cerr << "Failed to create player for ID: " << playerId << std::endl;
+            delete c;
+        }
+        return;
+    }
+
+    // Update client state tracking
+    if (input.j > g[playerId]) {
+        g[playerId] = input.j; // Update last client update time
+    }
+
+    // Get client's rocket state if provided
+    if (input.k.j) { // If this is authoritative from client
+        // Store the client's rocket state
+        f[playerId].c.clear();
+        f[playerId].c.push_back(input.k);
+
+        // Mark client simulation as valid
+        h[playerId] = true;
+    }
+
+    // Inputs that arrive together are still applied a tick apart. A client
+    // that gets far ahead loses its oldest inputs rather than falling behind for good.
+    std::deque<PlayerInput>& b = m[playerId];
+    b.push_back(input);
+    while (b.size() > GameConstants::SERVER_INPUT_BUFFER) {
+        b.pop_front();
+    }
+}
+
+void GameServer::applyQueuedInputs() {
+    for (auto& a : m) {
+        if (a.second.empty()) continue;
+
+        PlayerInput b = a.second.front();
+        a.second.pop_front();
+
+        VehicleManager* c = getPlayer(a.first);
+        if (!c) continue; // Add null check
+
+        // The network layer only passes on inputs newer than the last, so this
+        // is what the player's next state acks
+        if (b.l != 0) {
+            l[a.first] = b.l;
+        }
+        applyPlayerInput(c, b);
+    }
+}
+
+void GameServer::applyPlayerInput(VehicleManager* player, const PlayerInput& input) {
+    // Apply input to the vehicle
+    if (input.b) {
+        player->applyThrust(1.0f);
+    }
+    if (input.c) {
+        player->applyThrust(-0.5f);
+    }
+    if (input.d) {
+        player->rotate(-6.0f * input.h * 60.0f);
+    }
+    if (input.e) {
+        player->rotate(6.0f * input.h * 60.0f);
+    }
+    if (input.f) {
+        player->switchVehicle();
+    }
+
+    // Apply thrust level with null checking
+    if (player->getActiveVehicleType() == VehicleType::ROCKET && player->getRocket()) {
+        player->getRocket()->setThrustLevel(input.g);
+    }
+}
+
+void GameServer::processClientSimulation(int playerId, const GameState& clientState) {
+    // Store the client's latest state
+    f[playerId] = clientState;
+    g[playerId] = clientState.b; // Update timestamp
+
+    // Validate the client simulation
+    GameState a = validateClientSimulation(playerId, clientState);
+
+    // If validation changed something, send back the corrected state
+    if (!h[playerId]) {
+        // TODO: Send validation state back to client
+    }
+}
+
+GameState GameServer::validateClientSimulation(int playerId, const GameState& clientState) {
+    GameState a = clientState;
+    bool b = true;
+
+    // Get server's state for this player
+    VehicleManager* c = getPlayer(playerId);
+    if (!c || !c->getRocket()) {
+        h[playerId] = false;
+        return a;
+    }
+
+    // Compare key values between client and server rocket states
+    if (!clientState.c.empty()) {
+        const RocketState& d = clientState.c[0];
+
+        // Create current server rocket state
+        RocketState e;
+        c->createState(e);
+
+        // Check position difference
+        sf::Vector2f f = d.b - e.b;
+        float g = std::sqrt(f.x * f.x + f.y * f.y);
+
+        // Check velocity difference
+        sf::Vector2f h = d.c - e.c;
+        float j = std::sqrt(h.x * h.x + h.y * h.y);
+
+        // If difference exceeds threshold, client simulation is invalid
+        if (g > i || j > i * 10.0f) {
+            b = false;
+
+            // Update the client state with server state, and tell the client
+            // which of its inputs that state already includes
+            a.c.clear();
+            a.c.push_back(e);
+            auto k = l.find(playerId);
+            a.f = k != l.end() ? k->second : 0;
+        }
+    }
+
+    // Update validation status
+    this->h[playerId] = b;
+
+    return a;
+}
+
+void GameServer::synchronizeState() {
+    // For each player, check if their simulation is valid
+    for (auto& a : c) {
+        int b = a.first;
+
+        // Skip validation for server player (ID 0)
+        if (b == 0) continue;
+
+        // Get server's state for this player
+        if (f.find(b) != f.end() && h.find(b) != h.find(b)) {
+            // Check if client simulation is valid
+            if (!h[b]) {
+                // Client simulation invalid - next update will send correction
+                continue;
+            }
+
+            // Check time since last update
+            float c = e - g[b];
+            if (c > 5.0f) {
+                // Too long since last update, mark invalid
+                h[b] = false;
+            }
+        }
+    }
+}
+
+GameState GameServer::getGameState() const {
+    GameState a;
+    a.a = d;
+    a.b = e;
+    a.e = false; // Not initial state by default
+    a.f = 0; // No receiving player - getGameStateFor fills it in
+
+    try {
+        // Add all rockets
+        for (const auto& b : c) {
+            int c = b.first;
+            const VehicleManager* d = b.second;
+
+            // Add null checks
+            if (!d) continue;
+
+            // Only add if it's a rocket
+            if (d->getActiveVehicleType() == VehicleType::ROCKET) {
+                const Rocket* e = d->getRocket();
+
+                // Add null check for rocket
+                if (!e) continue;
+
+                RocketState f;
+                f.a = c;  // playerId
+                f.b = e->getPosition();  // position
+                f.c = e->getVelocity();  // velocity
+                f.d = e->getRotation();  // rotation
+                f.e = e->getAngularVelocity();  // angularVelocity
+                f.f = e->getThrustLevel();  // thrustLevel
+                f.g = e->getMass();  // mass
+                f.h = e->getColor();  // color
+                f.i = this->e;  // current server timestamp
+                f.j = true;  // Server state is authoritative
+
+                a.c.push_back(f);
+            }
+            // TODO: Add car state if needed
+        }
+
+        // Add all planets
+        for (size_t b = 0; b < this->b.size(); ++b) {
+            const Planet* c = this->b[b];
+
+            // Skip null planets
+            if (!c) continue;
+
+            PlanetState d;
+            d.a = c->getHandle().toId();  // planetId
+            d.b = c->getPosition();  // position
+            d.c = c->getVelocity();  // velocity
+            d.d = c->getMass();  // mass
+            d.e = c->getRadius();  // radius
+            d.f = c->getColor();  // color
+            d.g = c->getOwnerId();  // ownerId
+            d.h = this->e;  // timestamp
+
+            a.d.push_back(d);
+        }
+    }
+    catch (const std::exception& b) {
+        std::cerr << "Exception in getGameState: " << b.what() << std::endl;
+        // Return a minimal valid state to avoid crashes
+    }
+
+    return a;
+}
+
+GameState GameServer::getGameStateFor(int playerId) {
+    auto a = c.find(playerId);
+    GameObject* b = (a != c.end() && a->second) ? a->second->getActiveVehicle() : nullptr;
+    auto f = l.find(playerId);
+    uint32_t g = f != l.end() ? f->second : 0;
+
+    if (!b) {
+        // No vehicle to stand at - everything is relevant
+        GameState e = getGameState();
+        e.f = g;
+        return e;
+    }
+
+    // The full state is gathered once per tick and shared by every client
+    if (k != static_cast<long long>(d)) {
+        j.beginTick(getGameState());
+        k = static_cast<long long>(d);
+    }
+
+    GameState e;
+    j.buildState(playerId, b->getPosition(), b->getVelocity(), e);
+    e.f = g;
+    return e;
 }
\ No newline at end of file
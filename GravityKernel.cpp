@@ -0,0 +1,308 @@
+// GravityKernel.cpp
+#include "GravityKernel.h"
+#include <cmath>
+#include <algorithm>
+#include <iostream>
+#include <random>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define GRAVITY_KERNEL_X86 1
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+// MSVC compiles AVX2 intrinsics in any function
+#define GRAVITY_TARGET_AVX2
+#else
+#define GRAVITY_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#endif
+#endif
+
+namespace GravityKernel {
+
+    namespace {
+        // Largest relative error selfTest() accepts. One Newton-Raphson step
+        // leaves ~1e-6 per body, summation order adds a little on top.
+        constexpr double SELF_TEST_TOLERANCE = 1e-4;
+
+        InstructionSet initialInstructionSet() {
+#ifdef _DEBUG
+            if (!selfTest()) {
+                std::cerr << "Gravity kernel self-test failed, using the scalar path" << std::endl;
+                return InstructionSet::SCALAR;
+            }
+#endif
+            return detectInstructionSet();
+        }
+
+        InstructionSet& activeInstructionSet() {
+            static InstructionSet a = initialInstructionSet();
+            return a;
+        }
+
+#ifdef GRAVITY_KERNEL_X86
+        // Approximate 1/sqrt(x) refined with one Newton-Raphson step (~23 bits)
+        inline __m128 reciprocalSqrt(__m128 x) {
+            const __m128 a = _mm_rsqrt_ps(x);
+            const __m128 b = _mm_mul_ps(_mm_mul_ps(x, a), a);
+            return _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), a), _mm_sub_ps(_mm_set1_ps(3.0f), b));
+        }
+
+        void accumulateSSE(const PackedBodies& sources, float px, float py, float radius,
+            float G, float minDistance, float& ax, float& ay)
+        {
+            const size_t a = sources.size();
+            const bool b = minDistance > 0.0f; // clamp
+
+            const __m128 c = _mm_set1_ps(px);
+            const __m128 d = _mm_set1_ps(py);
+            const __m128 e = _mm_set1_ps(radius);
+            const __m128 f = _mm_set1_ps(G);
+            const __m128 g = _mm_set1_ps(minDistance * minDistance);
+            __m128 h = _mm_setzero_ps(); // sumX
+            __m128 i = _mm_setzero_ps(); // sumY
+
+            size_t j = 0;
+            for (; j + 4 <= a; j += 4) {
+                __m128 dx = _mm_sub_ps(_mm_loadu_ps(&sources.a[j]), c);
+                __m128 dy = _mm_sub_ps(_mm_loadu_ps(&sources.b[j]), d);
+                __m128 distSquared = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+
+                // Only bodies outside contact range pull (this also drops the target itself)
+                __m128 reach = _mm_add_ps(_mm_loadu_ps(&sources.d[j]), e);
+                __m128 mask = _mm_cmpgt_ps(distSquared, _mm_mul_ps(reach, reach));
+
+                __m128 inv = reciprocalSqrt(distSquared);
+                __m128 invForce = b ? reciprocalSqrt(_mm_max_ps(distSquared, g)) : inv;
+
+                // G * m / (d * dForce^2) - masked lanes may hold inf/NaN, the AND clears them
+                __m128 k = _mm_mul_ps(_mm_mul_ps(f, _mm_loadu_ps(&sources.c[j])),
+                    _mm_mul_ps(inv, _mm_mul_ps(invForce, invForce)));
+                k = _mm_and_ps(k, mask);
+
+                h = _mm_add_ps(h, _mm_mul_ps(dx, k));
+                i = _mm_add_ps(i, _mm_mul_ps(dy, k));
+            }
+
+            alignas(16) float sumX[4];
+            alignas(16) float sumY[4];
+            _mm_store_ps(sumX, h);
+            _mm_store_ps(sumY, i);
+            ax += (sumX[0] + sumX[1]) + (sumX[2] + sumX[3]);
+            ay += (sumY[0] + sumY[1]) + (sumY[2] + sumY[3]);
+
+            // Scalar tail for the last count % 4 bodies
+            accumulateScalar(sources, j, px, py, radius, G, minDistance, ax, ay);
+        }
+
+        GRAVITY_TARGET_AVX2 inline __m256 reciprocalSqrt256(__m256 x) {
+            const __m256 a = _mm256_rsqrt_ps(x);
+            const __m256 b = _mm256_mul_ps(_mm256_mul_ps(x, a), a);
+            return _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(0.5f), a), _mm256_sub_ps(_mm256_set1_ps(3.0f), b));
+        }
+
+        GRAVITY_TARGET_AVX2 void accumulateAVX2(const PackedBodies& sources, float px, float py, float radius,
+            float G, float minDistance, float& ax, float& ay)
+        {
+            const size_t a = sources.size();
+            const bool b = minDistance > 0.0f; // clamp
+
+            const __m256 c = _mm256_set1_ps(px);
+            const __m256 d = _mm256_set1_ps(py);
+            const __m256 e = _mm256_set1_ps(radius);
+            const __m256 f = _mm256_set1_ps(G);
+            const __m256 g = _mm256_set1_ps(minDistance * minDistance);
+            __m256 h = _mm256_setzero_ps(); // sumX
+            __m256 i = _mm256_setzero_ps(); // sumY
+
+            size_t j = 0;
+            for (; j + 8 <= a; j += 8) {
+                __m256 dx = _mm256_sub_ps(_mm256_loadu_ps(&sources.a[j]), c);
+                __m256 dy = _mm256_sub_ps(_mm256_loadu_ps(&sources.b[j]), d);
+                __m256 distSquared = _mm256_fmadd_ps(dx, dx, _mm256_mul_ps(dy, dy));
+
+                __m256 reach = _mm256_add_ps(_mm256_loadu_ps(&sources.d[j]), e);
+                __m256 mask = _mm256_cmp_ps(distSquared, _mm256_mul_ps(reach, reach), _CMP_GT_OQ);
+
+                __m256 inv = reciprocalSqrt256(distSquared);
+                __m256 invForce = b ? reciprocalSqrt256(_mm256_max_ps(distSquared, g)) : inv;
+
+                __m256 k = _mm256_mul_ps(_mm256_mul_ps(f, _mm256_loadu_ps(&sources.c[j])),
+                    _mm256_mul_ps(inv, _mm256_mul_ps(invForce, invForce)));
+                k = _mm256_and_ps(k, mask);
+
+                h = _mm256_fmadd_ps(dx, k, h);
+                i = _mm256_fmadd_ps(dy, k, i);
+            }
+
+            alignas(32) float sumX[8];
+            alignas(32) float sumY[8];
+            _mm256_store_ps(sumX, h);
+            _mm256_store_ps(sumY, i);
+            ax += ((sumX[0] + sumX[1]) + (sumX[2] + sumX[3])) + ((sumX[4] + sumX[5]) + (sumX[6] + sumX[7]));
+            ay += ((sumY[0] + sumY[1]) + (sumY[2] + sumY[3])) + ((sumY[4] + sumY[5]) + (sumY[6] + sumY[7]));
+
+            // Scalar tail for the last count % 8 bodies
+            accumulateScalar(sources, j, px, py, radius, G, minDistance, ax, ay);
+        }
+#endif
+    }
+
+    InstructionSet detectInstructionSet() {
+#ifdef GRAVITY_KERNEL_X86
+#ifdef _MSC_VER
+        int a[4];
+        __cpuid(a, 0);
+        int b = a[0]; // highest leaf
+
+        __cpuid(a, 1);
+        bool c = (a[3] & (1 << 25)) != 0; // SSE
+        bool d = (a[2] & (1 << 27)) != 0; // OSXSAVE
+        bool e = (a[2] & (1 << 28)) != 0; // AVX
+        bool f = (a[2] & (1 << 12)) != 0; // FMA
+
+        bool g = false; // AVX2
+        if (b >= 7) {
+            __cpuidex(a, 7, 0);
+            g = (a[1] & (1 << 5)) != 0;
+        }
+
+        // The OS must also save the YMM registers on context switches
+        bool h = d && (_xgetbv(0) & 0x6) == 0x6;
+
+        if (g && e && f && h) return InstructionSet::AVX2;
+        if (c) return InstructionSet::SSE;
+#else
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) return InstructionSet::AVX2;
+        if (__builtin_cpu_supports("sse")) return InstructionSet::SSE;
+#endif
+#endif
+        return InstructionSet::SCALAR;
+    }
+
+    void setInstructionSet(InstructionSet set) {
+        InstructionSet a = detectInstructionSet();
+        activeInstructionSet() = (static_cast<int>(set) > static_cast<int>(a)) ? a : set;
+    }
+
+    InstructionSet getInstructionSet() {
+        return activeInstructionSet();
+    }
+
+    const char* getInstructionSetName(InstructionSet set) {
+        switch (set) {
+        case InstructionSet::AVX2: return "AVX2";
+        case InstructionSet::SSE: return "SSE";
+        default: return "Scalar";
+        }
+    }
+
+    void accumulate(const PackedBodies& sources, float px, float py, float radius,
+        float G, float minDistance, float& ax, float& ay)
+    {
+#ifdef GRAVITY_KERNEL_X86
+        switch (activeInstructionSet()) {
+        case InstructionSet::AVX2:
+            accumulateAVX2(sources, px, py, radius, G, minDistance, ax, ay);
+            return;
+        case InstructionSet::SSE:
+            accumulateSSE(sources, px, py, radius, G, minDistance, ax, ay);
+            return;
+        default:
+            break;
+        }
+#endif
+        accumulateScalar(sources, 0, px, py, radius, G, minDistance, ax, ay);
+    }
+
+    bool selfTest() {
+#ifdef GRAVITY_KERNEL_X86
+        const InstructionSet a = detectInstructionSet();
+        std::mt19937 b(12345); // fixed seed - the same bodies every run
+        std::uniform_real_distribution<float> position(-1000.0f, 1000.0f);
+        std::uniform_real_distribution<float> mass(1.0f, 100.0f);
+        std::uniform_real_distribution<float> bodyRadius(0.0f, 5.0f);
+
+        // Counts around the vector widths exercise the scalar tails too
+        const size_t c[] = { 1, 3, 4, 7, 8, 9, 33, 257 };
+        const float d[] = { 0.0f, 25.0f }; // minDistance - unclamped and clamped
+        const float G = 6.674f;
+        bool e = true;
+
+        for (size_t f : c) {
+            PackedBodies g;
+            for (size_t h = 0; h < f; h++) {
+                g.add(position(b), position(b), mass(b), bodyRadius(b));
+            }
+
+            for (float minDistance : d) {
+                for (int h = 0; h < 16; h++) {
+                    float px = position(b);
+                    float py = position(b);
+                    float radius = bodyRadius(b);
+
+                    float refX = 0.0f, refY = 0.0f;
+                    accumulateScalar(g, 0, px, py, radius, G, minDistance, refX, refY);
+
+                    // Scale by the summed magnitudes, so pulls that cancel do not
+                    // turn rounding into a large relative error
+                    double scale = 0.0;
+                    for (size_t i = 0; i < g.size(); i++) {
+                        float ix = 0.0f, iy = 0.0f;
+                        PackedBodies j;
+                        j.add(g.a[i], g.b[i], g.c[i], g.d[i]);
+                        accumulateScalar(j, 0, px, py, radius, G, minDistance, ix, iy);
+                        scale += std::sqrt(static_cast<double>(ix) * ix + static_cast<double>(iy) * iy);
+                    }
+                    if (scale == 0.0) continue;
+
+                    for (InstructionSet set : { InstructionSet::SSE, InstructionSet::AVX2 }) {
+                        if (static_cast<int>(set) > static_cast<int>(a)) continue;
+
+                        float testX = 0.0f, testY = 0.0f;
+                        if (set == InstructionSet::AVX2) {
+                            accumulateAVX2(g, px, py, radius, G, minDistance, testX, testY);
+                        }
+                        else {
+                            accumulateSSE(g, px, py, radius, G, minDistance, testX, testY);
+                        }
+
+                        double k = std::hypot(static_cast<double>(testX) - refX, static_cast<double>(testY) - refY) / scale;
+                        if (!(k <= SELF_TEST_TOLERANCE)) {
+                            std::cerr << "Gravity kernel " << getInstructionSetName(set) << " differs from scalar by "
+                                << k << " relative (" << f << " bodies, minDistance " << minDistance << ")" << std::endl;
+                            e = false;
+                        }
+                    }
+                }
+            }
+        }
+        return e;
+#else
+        // Only the scalar path exists
+        return true;
+#endif
+    }
+
+    void accumulateScalar(const PackedBodies& sources, size_t begin, float px, float py, float radius,
+        float G, float minDistance, float& ax, float& ay)
+    {
+        const float a = minDistance * minDistance;
+
+        for (size_t b = begin; b < sources.size(); b++) {
+            float dx = sources.a[b] - px;
+            float dy = sources.b[b] - py;
+            float distSquared = dx * dx + dy * dy;
+            float reach = sources.d[b] + radius;
+
+            if (distSquared > reach * reach) {
+                float dist = std::sqrt(distSquared);
+                float forceDistSquared = std::max(distSquared, a);
+                float k = G * sources.c[b] / (dist * forceDistSquared);
+                ax += dx * k;
+                ay += dy * k;
+            }
+        }
+    }
+
+} // namespace GravityKernel
@@ -0,0 +1,58 @@
+// GravityKernel.h
+#pragma once
+#include <vector>
+#include <cstddef>
+
+// Packed source bodies for the gravity kernel. Only bodies that actually pull
+// are packed, so the kernel needs no per-body filtering.
+struct PackedBodies {
+    std::vector<float> a; // positionX
+    std::vector<float> b; // positionY
+    std::vector<float> c; // mass
+    std::vector<float> d; // radius
+
+    void clear() { a.clear(); b.clear(); c.clear(); d.clear(); }
+    void add(float x, float y, float mass, float radius) {
+        a.push_back(x);
+        b.push_back(y);
+        c.push_back(mass);
+        d.push_back(radius);
+    }
+    size_t size() const { return a.size(); }
+};
+
+namespace GravityKernel {
+    enum class InstructionSet {
+        SCALAR,
+        SSE,  // 4 bodies per instruction
+        AVX2  // 8 bodies per instruction
+    };
+
+    // Best instruction set the CPU and OS support
+    InstructionSet detectInstructionSet();
+
+    // Instruction set used by accumulate(). Defaults to detectInstructionSet().
+    // Requests above what the CPU supports are lowered to the best supported one.
+    void setInstructionSet(InstructionSet set);
+    InstructionSet getInstructionSet();
+    const char* getInstructionSetName(InstructionSet set);
+
+    // Adds to (ax, ay) the acceleration at (px, py) from every packed body:
+    //   G * mass * (p_j - p) / |p_j - p|^3
+    // A body only pulls when |p_j - p| > radius_j + radius, which also skips the
+    // target itself. If minDistance > 0 the distance used for the force magnitude
+    // is clamped to at least minDistance (the direction is unchanged).
+    void accumulate(const PackedBodies& sources, float px, float py, float radius,
+        float G, float minDistance, float& ax, float& ay);
+
+    // Plain C++ reference implementation with std::sqrt - the vector paths use an
+    // approximate reciprocal square root and agree with it to ~1e-6 relative
+    void accumulateScalar(const PackedBodies& sources, size_t begin, float px, float py, float radius,
+        float G, float minDistance, float& ax, float& ay);
+
+    // Runs random bodies through every vector path the CPU supports and checks
+    // the result against accumulateScalar. Reports mismatches on std::cerr.
+    // Debug builds run it before the first accumulate() and fall back to the
+    // scalar path if it fails.
+    bool selfTest();
+}
@@ -1,327 +1,672 @@
-// Update in GravitySimulator.cpp
-#include "GravitySimulator.h"
-#include "VehicleManager.h"
-
-GravitySimulator::GravitySimulator(int ownerId)
-    : d(GameConstants::G), e(true), f(ownerId)
-{
-}
-
-void GravitySimulator::addPlanet(Planet* planet)
-{
-    a.push_back(planet);
-}
-
-void GravitySimulator::addRocket(Rocket* rocket)
-{
-    b.push_back(rocket);
-}
-
-void GravitySimulator::clearRockets()
-{
-    b.clear();
-}
-
-bool GravitySimulator::shouldSimulateObject(int objectOwnerId) const
-{
-    // If no owner is set, simulate everything
-    if (f == -1) return true;
-
-    // If object has no owner, it's a common object - simulate it
-    if (objectOwnerId == -1) return true;
-
-    // Otherwise, only simulate objects owned by this simulator's owner
-    return objectOwnerId == f;
-}
-
-void GravitySimulator::updateVehicleManagerPlanets() {
-    if (!c) return;
-
-    try {
-        c->updatePlanets(a);
-    }
-    catch (const std::exception& e) {
-        std::cerr << "Exception in updateVehicleManagerPlanets: " << e.what() << std::endl;
-    }
-}
-
-void GravitySimulator::addRocketGravityInteractions(float deltaTime)
-{
-    // Apply gravity between rockets
-    for (size_t a = 0; a < b.size(); a++) {
-        if (!shouldSimulateObject(b[a]->getOwnerId())) continue;
-
-        for (size_t c = a + 1; c < b.size(); c++) {
-            if (!shouldSimulateObject(b[c]->getOwnerId())) continue;
-
-            Rocket* d = b[a];
-            Rocket* e = b[c];
-
-            sf::Vector2f f = e->getPosition() - d->getPosition();
-            float g = std::sqrt(f.x * f.x + f.y * f.y);
-
-            // Minimum distance to prevent extreme forces when very close
-            const float h = GameConstants::TRAJECTORY_COLLISION_RADIUS;
-            if (g < h) {
-                g = h;
-            }
-
-            // Apply inverse square law for gravity
-            float i = this->d * d->getMass() * e->getMass() / (g * g);
-
-            sf::Vector2f j = normalize(f);
-            sf::Vector2f k = j * i / d->getMass();
-            sf::Vector2f l = -j * i / e->getMass();
-
-            d->setVelocity(d->getVelocity() + k * deltaTime);
-            e->setVelocity(e->getVelocity() + l * deltaTime);
-        }
-    }
-}
-
-void GravitySimulator::checkPlanetCollisions() {
-    if (a.size() < 2) return;
-
-    std::vector<Planet*> a;
-    std::vector<Planet*> b;
-    std::vector<bool> c(this->a.size(), false);
-
-    // First pass: identify small planets to remove and do null checks
-    for (size_t d = 0; d < this->a.size(); d++) {
-        Planet* e = this->a[d];
-        if (!e) {
-            // Mark null planets for deletion
-            c[d] = true;
-            continue;
-        }
-
-        // Only check planets we should simulate
-        if (!shouldSimulateObject(e->getOwnerId())) continue;
-
-        // Check if the planet's mass is below threshold
-        if (e->getMass() < 10.0f) {
-            b.push_back(e);
-            c[d] = true;
-            this->a[d] = nullptr; // Explicitly set to nullptr to prevent further access
-        }
-    }
-
-    // Second pass: check for collisions between non-deleted planets
-    for (size_t d = 0; d < this->a.size(); d++) {
-        if (c[d]) continue; // Skip already marked planets
-
-        Planet* e = this->a[d];
-        if (!e) continue; // Extra safety check
-
-        // Only process planets we should simulate
-        if (!shouldSimulateObject(e->getOwnerId())) continue;
-
-        for (size_t f = d + 1; f < this->a.size(); f++) {
-            if (c[f]) continue; // Skip already marked planets
-
-            Planet* g = this->a[f];
-            if (!g) continue; // Extra safety check
-
-            // Only process planets we should simulate
-            if (!shouldSimulateObject(g->getOwnerId())) continue;
-
-            // Calculate distance safely
-            sf::Vector2f h;
-            try {
-                h = g->getPosition() - e->getPosition();
-            }
-            catch (const std::exception& i) {
-                std::cerr << "Exception calculating planet distance: " << i.what() << std::endl;
-                continue; // Skip this pair if an exception occurs
-            }
-
-            float i = std::sqrt(h.x * h.x + h.y * h.y);
-
-            // Check for collision
-            if (i <= e->getRadius() + g->getRadius()) {
-                try {
-                    // Determine which planet is larger
-                    if (e->getMass() >= g->getMass()) {
-                        // Planet 1 absorbs planet 2
-                        float j = e->getMass() + (g->getMass());
-
-                        // Conservation of momentum for velocity
-                        sf::Vector2f k = (e->getVelocity() * e->getMass() +
-                            g->getVelocity() * g->getMass()) / j;
-
-                        // Keep original owner
-                        int l = e->getOwnerId();
-
-                        // Update planet 1
-                        e->setMass(j);
-                        e->setVelocity(k);
-                        e->setOwnerId(l);
-
-                        // Mark planet 2 for deletion
-                        if (!c[f]) {
-                            b.push_back(g);
-                            c[f] = true;
-                            this->a[f] = nullptr; // Explicitly set to nullptr
-                        }
-                    }
-                    else {
-                        // Planet 2 absorbs planet 1
-                        float j = e->getMass() + g->getMass();
-
-                        // Conservation of momentum for velocity
-                        sf::Vector2f k = (e->getVelocity() * e->getMass() +
-                            g->getVelocity() * g->getMass()) / j;
-
-                        // Keep original owner
-                        int l = g->getOwnerId();
-
-                        // Update planet 2
-                        g->setMass(j);
-                        g->setVelocity(k);
-                        g->setOwnerId(l);
-
-                        // Mark planet 1 for deletion
-                        if (!c[d]) {
-                            b.push_back(e);
-                            c[d] = true;
-                            this->a[d] = nullptr; // Explicitly set to nullptr
-                        }
-                        break; // Exit inner loop since planet 1 is gone
-                    }
-                }
-                catch (const std::exception& i) {
-                    std::cerr << "Exception during planet collision: " << i.what() << std::endl;
-                    continue; // Skip this pair if an exception occurs
-                }
-            }
-        }
-    }
-
-    // Build the filtered list of planets to keep
-    for (size_t d = 0; d < this->a.size(); d++) {
-        if (!c[d] && this->a[d]) {
-            a.push_back(this->a[d]);
-        }
-    }
-
-    // Delete the marked planets safely
-    for (Planet* d : b) {
-        if (d) { // Extra safety check
-            try {
-                delete d;
-            }
-            catch (const std::exception& e) {
-                std::cerr << "Exception deleting planet: " << e.what() << std::endl;
-            }
-        }
-    }
-
-    // Replace the planets vector with the filtered list
-    this->a = a;
-
-    // Update planets in vehicle manager - use our method
-    try {
-        updateVehicleManagerPlanets();
-    }
-    catch (const std::exception& d) {
-        std::cerr << "Exception updating vehicle manager planets: " << d.what() << std::endl;
-    }
-}
-
-void GravitySimulator::update(float deltaTime)
-{
-    // Apply gravity between planets if enabled
-    if (e) {
-        for (size_t a = 0; a < this->a.size(); a++) {
-            // Only process planets we should simulate
-            if (!shouldSimulateObject(this->a[a]->getOwnerId())) continue;
-
-            for (size_t b = a + 1; b < this->a.size(); b++) {
-                // Only process planets we should simulate
-                if (!shouldSimulateObject(this->a[b]->getOwnerId())) continue;
-
-                Planet* c = this->a[a];
-                Planet* d = this->a[b];
-
-                // Skip the first planet (index 0) - it's pinned in place
-                if (a == 0) {
-                    // Only apply gravity from planet1 to planet2
-                    sf::Vector2f e = c->getPosition() - d->getPosition();
-                    float f = std::sqrt(e.x * e.x + e.y * e.y);
-
-                    if (f > c->getRadius() + d->getRadius()) {
-                        float g = this->d * c->getMass() * d->getMass() / (f * f);
-                        sf::Vector2f h = normalize(e);
-                        sf::Vector2f i = h * g / d->getMass();
-                        d->setVelocity(d->getVelocity() + i * deltaTime);
-                    }
-                }
-                else {
-                    // Regular gravity calculation between other planets
-                    sf::Vector2f e = d->getPosition() - c->getPosition();
-                    float f = std::sqrt(e.x * e.x + e.y * e.y);
-
-                    if (f > c->getRadius() + d->getRadius()) {
-                        float g = this->d * c->getMass() * d->getMass() / (f * f);
-                        sf::Vector2f h = normalize(e);
-                        sf::Vector2f i = h * g / c->getMass();
-                        sf::Vector2f j = -h * g / d->getMass();
-                        c->setVelocity(c->getVelocity() + i * deltaTime);
-                        d->setVelocity(d->getVelocity() + j * deltaTime);
-                    }
-                }
-            }
-        }
-    }
-
-    // Apply gravity to the vehicle manager's active vehicle
-    if (c) {
-        // Only apply if we should simulate this vehicle
-        if (shouldSimulateObject(c->getOwnerId())) {
-            if (c->getActiveVehicleType() == VehicleType::ROCKET) {
-                Rocket* a = c->getRocket();
-                if (a) {
-                    for (auto b : this->a) {
-                        sf::Vector2f c = b->getPosition() - a->getPosition();
-                        float d = std::sqrt(c.x * c.x + c.y * c.y);
-
-                        // Avoid division by zero and very small distances
-                        if (d > b->getRadius() + GameConstants::TRAJECTORY_COLLISION_RADIUS) {
-                            float e = this->d * b->getMass() * a->getMass() / (d * d);
-                            sf::Vector2f f = normalize(c) * e / a->getMass();
-                            sf::Vector2f g = f * deltaTime;
-                            a->setVelocity(a->getVelocity() + g);
-                        }
-                    }
-                }
-            }
-            // Car gravity is handled internally in Car::update
-        }
-    }
-    else {
-        // Legacy code for handling individual rockets
-        for (auto a : b) {
-            // Only process rockets we should simulate
-            if (!shouldSimulateObject(a->getOwnerId())) continue;
-
-            for (auto b : this->a) {
-                sf::Vector2f c = b->getPosition() - a->getPosition();
-                float d = std::sqrt(c.x * c.x + c.y * c.y);
-
-                // Avoid division by zero and very small distances
-                if (d > b->getRadius() + GameConstants::TRAJECTORY_COLLISION_RADIUS) {
-                    float e = this->d * b->getMass() * a->getMass() / (d * d);
-                    sf::Vector2f f = normalize(c) * e / a->getMass();
-                    sf::Vector2f g = f * deltaTime;
-                    a->setVelocity(a->getVelocity() + g);
-                }
-            }
-        }
-
-        // Add rocket-to-rocket gravity interactions
-        addRocketGravityInteractions(deltaTime);
-    }
-
-    // Check for planet collisions and cleanup too-small planets
-    checkPlanetCollisions();
+// Update in GravitySimulator.cpp
+#include "GravitySimulator.h"
+#include "VehicleManager.h"
+#include "PlanetPool.h"
+#include <algorithm>
+
+GravitySimulator::GravitySimulator(int ownerId)
+    : d(GameConstants::G), e(true), f(ownerId),
+    g(GravitySolver::BARNES_HUT), h(GameConstants::BARNES_HUT_THETA), o(false),
+    p(GameConstants::GRAVITY_WORKER_THREADS), q(Integrator::LEAPFROG),
+    t(false), u(0.0, 0.0)
+{
+}
+
+void GravitySimulator::addPlanet(Planet* planet)
+{
+    a.push_back(planet);
+}
+
+void GravitySimulator::removePlanet(Planet* planet)
+{
+    auto b = std::find(a.begin(), a.end(), planet);
+    if (b == a.end()) return;
+
+    a.erase(b);
+
+    // Indices past the planet shifted - let the next collision pass rebuild the list
+    v.clear();
+    updateVehicleManagerPlanets();
+}
+
+Planet* GravitySimulator::findPlanet(EntityHandle handle) const
+{
+    Planet* b = PlanetPool::getInstance().get(handle);
+    if (!b || std::find(a.begin(), a.end(), b) == a.end()) return nullptr;
+    return b;
+}
+
+void GravitySimulator::addRocket(Rocket* rocket)
+{
+    b.push_back(rocket);
+}
+
+void GravitySimulator::clearRockets()
+{
+    b.clear();
+}
+
+bool GravitySimulator::shouldSimulateObject(int objectOwnerId) const
+{
+    // If no owner is set, simulate everything
+    if (f == -1) return true;
+
+    // If object has no owner, it's a common object - simulate it
+    if (objectOwnerId == -1) return true;
+
+    // Otherwise, only simulate objects owned by this simulator's owner
+    return objectOwnerId == f;
+}
+
+void GravitySimulator::updateVehicleManagerPlanets() {
+    if (!c) return;
+
+    try {
+        c->updatePlanets(a);
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Exception in updateVehicleManagerPlanets: " << e.what() << std::endl;
+    }
+}
+
+void GravitySimulator::addRocketGravityInteractions(float deltaTime)
+{
+    // Pack the rockets we simulate so the kernel can stream through them
+    n.clear();
+    for (auto a : b) {
+        if (!shouldSimulateObject(a->getOwnerId())) continue;
+        sf::Vector2f b = a->getPosition();
+        n.add(b.x, b.y, a->getMass(), 0.0f);
+    }
+    if (n.size() < 2) return;
+
+    // Evaluate every rocket against the same positions, then apply
+    size_t a = 0;
+    for (auto b : this->b) {
+        if (!shouldSimulateObject(b->getOwnerId())) continue;
+
+        // Minimum distance to prevent extreme forces when very close
+        float c = 0.0f;
+        float d = 0.0f;
+        GravityKernel::accumulate(n, n.a[a], n.b[a], 0.0f, this->d,
+            GameConstants::TRAJECTORY_COLLISION_RADIUS, c, d);
+        b->setVelocity(b->getVelocity() + sf::Vector2f(c, d) * deltaTime);
+        a++;
+    }
+}
+
+void GravitySimulator::syncSweepList()
+{
+    // addPlanet() appends, so new planets are the indices past the end of the list
+    if (v.size() > a.size()) {
+        v.clear();
+    }
+    for (size_t b = v.size(); b < a.size(); b++) {
+        SweepEntry c;
+        c.a = 0.0f;
+        c.b = 0.0f;
+        c.c = static_cast<int>(b);
+        v.push_back(c);
+    }
+}
+
+bool GravitySimulator::mergePlanets(int first, int second)
+{
+    Planet* b = a[first];
+    Planet* c = a[second];
+
+    // The heavier planet absorbs the lighter one and keeps its owner
+    Planet* d = b->getMass() >= c->getMass() ? b : c; // survivor
+    Planet* e = d == b ? c : b; // absorbed
+
+    float f = b->getMass() + c->getMass();
+
+    // Conservation of momentum for velocity
+    sf::Vector2f g = (b->getVelocity() * b->getMass() + c->getVelocity() * c->getMass()) / f;
+
+    d->setMass(f);
+    d->setVelocity(g);
+
+    w[e == b ? first : second] = -1;
+    return e == b;
+}
+
+void GravitySimulator::checkPlanetCollisions() {
+    if (a.size() < 2) return;
+
+    syncSweepList();
+
+    // w doubles as the removal flags here (-1 = remove) and the index remap below
+    w.assign(a.size(), 0);
+
+    // Refresh the bounding intervals and drop null and evaporated planets
+    for (auto& b : v) {
+        Planet* c = a[b.c];
+        b.d = false;
+
+        if (!c) {
+            w[b.c] = -1;
+            continue;
+        }
+
+        // Only check planets we should simulate
+        if (!shouldSimulateObject(c->getOwnerId())) continue;
+
+        // Check if the planet's mass is below threshold
+        if (c->getMass() < 10.0f) {
+            w[b.c] = -1;
+            continue;
+        }
+
+        float d = c->getPosition().x;
+        float e = c->getRadius();
+        b.a = d - e;
+        b.b = d + e;
+        b.d = true;
+    }
+
+    // The list is still sorted from last tick apart from whatever moved past a
+    // neighbour, so an insertion sort is close to linear here
+    for (size_t b = 1; b < v.size(); b++) {
+        SweepEntry c = v[b];
+        size_t d = b;
+        while (d > 0 && v[d - 1].a > c.a) {
+            v[d] = v[d - 1];
+            d--;
+        }
+        v[d] = c;
+    }
+
+    // Sweep along x - only planets whose x intervals overlap can touch
+    for (size_t b = 0; b < v.size(); b++) {
+        if (!v[b].d || w[v[b].c] < 0) continue;
+
+        for (size_t c = b + 1; c < v.size() && v[c].a <= v[b].b; c++) {
+            if (!v[c].d || w[v[c].c] < 0) continue;
+
+            Planet* d = a[v[b].c];
+            Planet* e = a[v[c].c];
+
+            sf::Vector2f f = e->getPosition() - d->getPosition();
+            float g = d->getRadius() + e->getRadius();
+            if (f.x * f.x + f.y * f.y > g * g) continue;
+
+            try {
+                if (mergePlanets(v[b].c, v[c].c)) {
+                    break; // The outer planet is gone
+                }
+                // The survivor grew - keep sweeping with its new extent
+                v[b].b = d->getPosition().x + d->getRadius();
+            }
+            catch (const std::exception& h) {
+                std::cerr << "Exception during planet collision: " << h.what() << std::endl;
+            }
+        }
+    }
+
+    // Delete the removed planets and compact the list in place
+    size_t b = 0;
+    bool c = false;
+    for (size_t d = 0; d < a.size(); d++) {
+        if (w[d] < 0) {
+            c = true;
+            if (a[d]) {
+                try {
+                    PlanetPool::getInstance().destroy(a[d]);
+                }
+                catch (const std::exception& e) {
+                    std::cerr << "Exception deleting planet: " << e.what() << std::endl;
+                }
+            }
+            continue;
+        }
+        w[d] = static_cast<int>(b);
+        a[b++] = a[d];
+    }
+    a.resize(b);
+
+    if (c) {
+        // Same order, new indices
+        size_t d = 0;
+        for (size_t e = 0; e < v.size(); e++) {
+            if (w[v[e].c] < 0) continue;
+            v[d] = v[e];
+            v[d].c = w[v[e].c];
+            d++;
+        }
+        v.resize(d);
+    }
+
+    // Update planets in vehicle manager - use our method
+    try {
+        updateVehicleManagerPlanets();
+    }
+    catch (const std::exception& d) {
+        std::cerr << "Exception updating vehicle manager planets: " << d.what() << std::endl;
+    }
+}
+
+bool GravitySimulator::useBarnesHut() const
+{
+    // Small systems are faster (and exact) with the pairwise loop
+    return g == GravitySolver::BARNES_HUT && a.size() >= GameConstants::BARNES_HUT_MIN_BODIES;
+}
+
+void GravitySimulator::gatherBodies()
+{
+    k.resize(a.size());
+
+    for (size_t b = 0; b < a.size(); b++) {
+        Planet* c = a[b];
+        if (!c) {
+            // Keep indices aligned with the planet list - a null entry pulls on nothing
+            k.a[b] = k.b[b] = k.c[b] = k.d[b] = 0.0f;
+            k.e[b] = 0.0f;
+            k.f[b] = 0.0f;
+            k.g[b] = -1;
+            k.j[b] = 0;
+            continue;
+        }
+
+        sf::Vector2f d = c->getPosition();
+        sf::Vector2f e = c->getVelocity();
+        k.a[b] = d.x;
+        k.b[b] = d.y;
+        k.c[b] = e.x;
+        k.d[b] = e.y;
+        k.e[b] = c->getMass();
+        k.f[b] = c->getRadius();
+        k.g[b] = c->getOwnerId();
+        k.j[b] = shouldSimulateObject(k.g[b]) ? 1 : 0;
+    }
+
+    // Packed source lists for the kernel: planets feel the simulated planets,
+    // rockets feel every planet
+    l.clear();
+    m.clear();
+    o = false;
+    for (size_t b = 0; b < k.size(); b++) {
+        if (k.e[b] <= 0.0f) continue;
+        if (k.j[b]) {
+            l.add(k.a[b], k.b[b], k.e[b], k.f[b]);
+        }
+        else {
+            o = true;
+        }
+    }
+    if (o) {
+        for (size_t b = 0; b < k.size(); b++) {
+            if (k.e[b] <= 0.0f) continue;
+            m.add(k.a[b], k.b[b], k.e[b], k.f[b]);
+        }
+    }
+
+    std::fill(k.h.begin(), k.h.end(), 0.0f);
+    std::fill(k.i.begin(), k.i.end(), 0.0f);
+}
+
+void GravitySimulator::scatterVelocities()
+{
+    // Planet 0 is pinned and never changes velocity here
+    for (size_t b = 1; b < a.size(); b++) {
+        if (!k.j[b] || !a[b]) continue;
+        a[b]->setVelocity(sf::Vector2f(k.c[b], k.d[b]));
+    }
+}
+
+void GravitySimulator::scatterState()
+{
+    // Positions were advanced here - tell Planet::update not to move them again
+    for (size_t b = 1; b < a.size(); b++) {
+        if (!k.j[b] || !a[b]) continue;
+        a[b]->setPosition(sf::Vector2f(k.a[b], k.b[b]));
+        a[b]->setVelocity(sf::Vector2f(k.c[b], k.d[b]));
+        a[b]->markIntegrated();
+    }
+}
+
+void GravitySimulator::packPlanetSources()
+{
+    l.clear();
+    for (size_t b = 0; b < k.size(); b++) {
+        if (k.e[b] <= 0.0f || !k.j[b]) continue;
+        l.add(k.a[b], k.b[b], k.e[b], k.f[b]);
+    }
+}
+
+void GravitySimulator::computePlanetAccelerations(bool useTree, bool positionsChanged)
+{
+    // Intermediate stages move the bodies, so the sources have to follow them
+    if (useTree) {
+        if (positionsChanged) {
+            i.clear();
+            for (size_t b = 0; b < k.size(); b++) {
+                if (k.e[b] <= 0.0f || !k.j[b]) continue;
+                i.addBody(sf::Vector2f(k.a[b], k.b[b]), k.e[b], k.f[b], static_cast<int>(b));
+            }
+            i.build();
+        }
+        computePlanetAccelerationsBarnesHut();
+    }
+    else {
+        if (positionsChanged) {
+            packPlanetSources();
+        }
+        computePlanetAccelerationsExact();
+    }
+}
+
+void GravitySimulator::integrateEuler(float deltaTime, bool useTree)
+{
+    computePlanetAccelerations(useTree, false);
+
+    for (size_t b = 1; b < k.size(); b++) {
+        if (!k.j[b]) continue;
+        k.c[b] += k.h[b] * deltaTime;
+        k.d[b] += k.i[b] * deltaTime;
+    }
+
+    // Planet::update does the drift with the new velocity
+    scatterVelocities();
+}
+
+void GravitySimulator::integrateLeapfrog(float deltaTime, bool useTree)
+{
+    const float a = deltaTime * 0.5f;
+
+    // Drift half a step, kick with the force at the midpoint, drift the rest
+    for (size_t b = 1; b < k.size(); b++) {
+        if (!k.j[b]) continue;
+        k.a[b] += k.c[b] * a;
+        k.b[b] += k.d[b] * a;
+    }
+
+    computePlanetAccelerations(useTree, true);
+
+    for (size_t b = 1; b < k.size(); b++) {
+        if (!k.j[b]) continue;
+        k.c[b] += k.h[b] * deltaTime;
+        k.d[b] += k.i[b] * deltaTime;
+        k.a[b] += k.c[b] * a;
+        k.b[b] += k.d[b] * a;
+    }
+
+    scatterState();
+}
+
+void GravitySimulator::integrateRK4(float deltaTime, bool useTree)
+{
+    // Stage weights and where the next stage is evaluated, as fractions of deltaTime
+    const float a[4] = { 1.0f, 2.0f, 2.0f, 1.0f };
+    const float b[3] = { 0.5f, 0.5f, 1.0f };
+
+    r.resize(k.size());
+    s.resize(k.size());
+    for (size_t c = 0; c < k.size(); c++) {
+        r.a[c] = k.a[c];
+        r.b[c] = k.b[c];
+        r.c[c] = k.c[c];
+        r.d[c] = k.d[c];
+        s.a[c] = s.b[c] = s.c[c] = s.d[c] = 0.0f;
+    }
+
+    for (int c = 0; c < 4; c++) {
+        // The first stage runs on the gathered state, which the sources already match
+        computePlanetAccelerations(useTree, c > 0);
+
+        for (size_t d = 1; d < k.size(); d++) {
+            if (!k.j[d]) continue;
+
+            // Slope of this stage: d(position) = velocity, d(velocity) = acceleration
+            s.a[d] += a[c] * k.c[d];
+            s.b[d] += a[c] * k.d[d];
+            s.c[d] += a[c] * k.h[d];
+            s.d[d] += a[c] * k.i[d];
+
+            if (c < 3) {
+                const float e = deltaTime * b[c];
+                float vx = k.c[d];
+                float vy = k.d[d];
+                k.a[d] = r.a[d] + vx * e;
+                k.b[d] = r.b[d] + vy * e;
+                k.c[d] = r.c[d] + k.h[d] * e;
+                k.d[d] = r.d[d] + k.i[d] * e;
+            }
+        }
+    }
+
+    const float e = deltaTime / 6.0f;
+    for (size_t d = 1; d < k.size(); d++) {
+        if (!k.j[d]) continue;
+        k.a[d] = r.a[d] + s.a[d] * e;
+        k.b[d] = r.b[d] + s.b[d] * e;
+        k.c[d] = r.c[d] + s.c[d] * e;
+        k.d[d] = r.d[d] + s.d[d] * e;
+    }
+
+    scatterState();
+}
+
+void GravitySimulator::buildTrees()
+{
+    i.clear();
+    j.clear();
+
+    bool a = false; // some planet is filtered out by ownership
+    for (size_t b = 0; b < k.size(); b++) {
+        if (k.e[b] <= 0.0f) continue;
+
+        // Rockets feel every planet, planets only feel the planets we simulate
+        sf::Vector2f c(k.a[b], k.b[b]);
+        j.addBody(c, k.e[b], k.f[b], static_cast<int>(b));
+        if (k.j[b]) {
+            i.addBody(c, k.e[b], k.f[b], static_cast<int>(b));
+        }
+        else {
+            a = true;
+        }
+    }
+
+    i.build();
+    if (a) {
+        j.build();
+    }
+    else {
+        // Same body set - reuse the planet tree for rockets
+        j.clear();
+    }
+}
+
+void GravitySimulator::forEachPlanet(const WorkerPool::RangeFunction& fn)
+{
+    // Planet 0 is pinned in place - it pulls on others but is never pulled
+    if (k.size() < 2) return;
+
+    // Each planet only writes its own acceleration slot, so the ranges never
+    // overlap and the threads need no locks or per-thread buffers
+    if (k.size() >= GameConstants::GRAVITY_PARALLEL_MIN_BODIES) {
+        p.parallelFor(k.size() - 1, [&fn](size_t begin, size_t end, size_t thread) {
+            fn(begin + 1, end + 1, thread);
+        });
+    }
+    else {
+        fn(1, k.size(), 0);
+    }
+}
+
+void GravitySimulator::computePlanetAccelerationsExact()
+{
+    forEachPlanet([this](size_t begin, size_t end, size_t) {
+        for (size_t b = begin; b < end; b++) {
+            // Only process planets we should simulate
+            if (!k.j[b]) continue;
+
+            float c = 0.0f;
+            float d = 0.0f;
+            GravityKernel::accumulate(l, k.a[b], k.b[b], k.f[b], this->d, 0.0f, c, d);
+            k.h[b] = c;
+            k.i[b] = d;
+        }
+    });
+}
+
+void GravitySimulator::computePlanetAccelerationsBarnesHut()
+{
+    forEachPlanet([this](size_t begin, size_t end, size_t) {
+        for (size_t b = begin; b < end; b++) {
+            if (!k.j[b]) continue;
+
+            sf::Vector2f c = i.accelerationAt(sf::Vector2f(k.a[b], k.b[b]), k.f[b], static_cast<int>(b), d, h);
+            k.h[b] = c.x;
+            k.i[b] = c.y;
+        }
+    });
+}
+
+void GravitySimulator::applyPlanetGravityToRocket(Rocket* rocket, float deltaTime, bool useTree)
+{
+    sf::Vector2f a = rocket->getPosition();
+    sf::Vector2f b(0.0f, 0.0f);
+
+    if (useTree) {
+        const BarnesHutTree& c = j.empty() ? i : j;
+        b = c.accelerationAt(a, GameConstants::TRAJECTORY_COLLISION_RADIUS, -1, d, h);
+    }
+    else {
+        // Avoid division by zero and very small distances
+        GravityKernel::accumulate(o ? m : l, a.x, a.y, GameConstants::TRAJECTORY_COLLISION_RADIUS,
+            d, 0.0f, b.x, b.y);
+    }
+
+    rocket->setVelocity(rocket->getVelocity() + b * deltaTime);
+}
+
+void GravitySimulator::beginReplay()
+{
+    x.clear();
+    for (auto a : this->a) {
+        if (!a || a->getMass() <= 0.0f) continue;
+        sf::Vector2f b = a->getPosition();
+        x.add(b.x, b.y, a->getMass(), a->getRadius());
+    }
+}
+
+void GravitySimulator::applyGravityToRocket(Rocket* rocket, float deltaTime)
+{
+    if (!rocket) return;
+
+    sf::Vector2f a = rocket->getPosition();
+    sf::Vector2f b(0.0f, 0.0f);
+    GravityKernel::accumulate(x, a.x, a.y, GameConstants::TRAJECTORY_COLLISION_RADIUS,
+        d, 0.0f, b.x, b.y);
+
+    rocket->setVelocity(rocket->getVelocity() + b * deltaTime);
+}
+
+void GravitySimulator::storePreviousPositions()
+{
+    // Start-of-step positions for render interpolation
+    for (auto a : this->a) {
+        if (a) a->storePreviousPosition();
+    }
+    for (auto a : b) {
+        if (a) a->storePreviousPosition();
+    }
+    if (c && c->getActiveVehicle()) {
+        c->getActiveVehicle()->storePreviousPosition();
+    }
+}
+
+void GravitySimulator::shiftOrigin(sf::Vector2f offset)
+{
+    for (auto planet : a) {
+        if (planet) planet->shiftOrigin(offset);
+    }
+    for (auto rocket : b) {
+        if (rocket) rocket->shiftOrigin(offset);
+    }
+    if (c) {
+        c->shiftOrigin(offset);
+    }
+
+    u.x += offset.x;
+    u.y += offset.y;
+}
+
+void GravitySimulator::rebaseOrigin()
+{
+    if (!c) return;
+    GameObject* a = c->getActiveVehicle();
+    if (!a) return;
+
+    sf::Vector2f b = a->getPosition();
+    const float limit = GameConstants::FLOATING_ORIGIN_DISTANCE;
+    if (b.x * b.x + b.y * b.y > limit * limit) {
+        shiftOrigin(b);
+    }
+}
+
+void GravitySimulator::update(float deltaTime)
+{
+    // Rebase before anything reads positions this step
+    if (t) {
+        rebaseOrigin();
+    }
+
+    storePreviousPositions();
+
+    // Snapshot planet state into the contiguous body store
+    gatherBodies();
+
+    bool a = useBarnesHut();
+    if (a) {
+        buildTrees();
+    }
+
+    // Rockets go first, while the trees and packed sources still hold the
+    // start-of-step planet positions - the integrators below move the planets
+
+    // Apply gravity to the vehicle manager's active vehicle
+    if (c) {
+        // Only apply if we should simulate this vehicle
+        if (shouldSimulateObject(c->getOwnerId())) {
+            if (c->getActiveVehicleType() == VehicleType::ROCKET) {
+                Rocket* b = c->getRocket();
+                if (b) {
+                    applyPlanetGravityToRocket(b, deltaTime, a);
+                }
+            }
+            // Car gravity is handled internally in Car::update
+        }
+    }
+    else {
+        // Legacy code for handling individual rockets
+        for (auto b : this->b) {
+            // Only process rockets we should simulate
+            if (!shouldSimulateObject(b->getOwnerId())) continue;
+
+            applyPlanetGravityToRocket(b, deltaTime, a);
+        }
+
+        // Add rocket-to-rocket gravity interactions
+        addRocketGravityInteractions(deltaTime);
+    }
+
+    // Apply gravity between planets if enabled
+    if (e) {
+        switch (q) {
+        case Integrator::RK4:
+            integrateRK4(deltaTime, a);
+            break;
+        case Integrator::LEAPFROG:
+            integrateLeapfrog(deltaTime, a);
+            break;
+        default:
+            integrateEuler(deltaTime, a);
+            break;
+        }
+    }
+
+    // Check for planet collisions and cleanup too-small planets
+    checkPlanetCollisions();
 }
\ No newline at end of file
@@ -1,43 +1,145 @@
-// GravitySimulator.h
-#pragma once
-#include "Planet.h"
-#include "Rocket.h"
-#include "VectorHelper.h"
-#include "GameConstants.h"  // Include the constants
-#include <vector>
-
-// Forward declaration
-class VehicleManager;
-
-class GravitySimulator {
-private:
-    std::vector<Planet*> a; // planets
-    std::vector<Rocket*> b; // rockets
-    VehicleManager* c; // vehicleManager
-    const float d; // G - Use the constant from the header
-    bool e; // simulatePlanetGravity
-    int f; // ownerId - for limiting simulation to owned objects
-
-public:
-    GravitySimulator(int ownerId = -1);
-
-    void addPlanet(Planet* planet);
-    void addRocket(Rocket* rocket);
-    void addVehicleManager(VehicleManager* manager) { c = manager; }
-    void update(float deltaTime);
-    void clearRockets();
-    void addRocketGravityInteractions(float deltaTime);
-    void checkPlanetCollisions();
-    const std::vector<Planet*>& getPlanets() const { return a; }
-    void setSimulatePlanetGravity(bool enable) { e = enable; }
-    int getOwnerId() const { return f; }
-
-    // Only simulate physics for planets/rockets owned by this simulator's owner
-    void setOwnerId(int id) { f = id; }
-    bool shouldSimulateObject(int objectOwnerId) const;
-
-    // Only declare the method, don't implement it here
-    void updateVehicleManagerPlanets();
-
-    void removeVehicleManager(VehicleManager* manager) { if (c == manager) { c = nullptr; } }
+// GravitySimulator.h
+#pragma once
+#include "Planet.h"
+#include "Rocket.h"
+#include "VectorHelper.h"
+#include "GameConstants.h"  // Include the constants
+#include "BarnesHutTree.h"
+#include "BodyStore.h"
+#include "GravityKernel.h"
+#include "WorkerPool.h"
+#include <vector>
+
+// Forward declaration
+class VehicleManager;
+
+// How planet-planet and planet-rocket gravity is evaluated
+enum class GravitySolver {
+    EXACT,      // O(n^2) pairwise loop - reference path for validation
+    BARNES_HUT  // Quadtree approximation, O(n log n)
+};
+
+// How planet positions and velocities are advanced each step
+enum class Integrator {
+    EULER,     // Semi-implicit Euler - velocity here, position in Planet::update. 1 force evaluation
+    LEAPFROG,  // Drift-kick-drift leapfrog. 2nd order and symplectic, 1 force evaluation
+    RK4        // Classic Runge-Kutta. 4th order but not symplectic, 4 force evaluations
+};
+
+class GravitySimulator {
+private:
+    // Planet in the collision broadphase, ordered by the left edge of its bounding box
+    struct SweepEntry {
+        float a; // minX
+        float b; // maxX
+        int c; // planetIndex
+        bool d; // active - simulated by this owner and not being removed
+    };
+
+    std::vector<Planet*> a; // planets
+    std::vector<Rocket*> b; // rockets
+    VehicleManager* c; // vehicleManager
+    const float d; // G - Use the constant from the header
+    bool e; // simulatePlanetGravity
+    int f; // ownerId - for limiting simulation to owned objects
+    GravitySolver g; // gravitySolver
+    float h; // openingAngle - Barnes-Hut theta
+    BarnesHutTree i; // planetTree - simulated planets, pulls on simulated planets
+    BarnesHutTree j; // rocketTree - every planet, pulls on rockets
+    BodyStore k; // bodies - SoA copy of planet state the force kernels run on
+    PackedBodies l; // planetSources - simulated planets, packed for the SIMD kernel
+    PackedBodies m; // rocketSources - every planet, only filled when the owner filter excludes some
+    PackedBodies n; // rocketBodies - simulated rockets for rocket-rocket gravity
+    bool o; // planetsFiltered - some planets are not simulated by this owner
+    WorkerPool p; // workerPool - splits the per-planet force loops across threads
+    Integrator q; // integrator
+    BodyStore r; // stepStart - RK4 state at the start of the step
+    BodyStore s; // stepSlope - RK4 weighted slope sums (position in a/b, velocity in c/d)
+    bool t; // floatingOrigin - keep the vehicle manager's active vehicle near (0, 0)
+    sf::Vector2<double> u; // originOffset - world position of the local origin
+    std::vector<SweepEntry> v; // sweepList - sort-and-sweep broadphase, kept sorted between ticks
+    std::vector<int> w; // collisionRemap - -1 for removed planets, otherwise the compacted index
+    PackedBodies x; // replaySources - every planet as beginReplay found it, for applyGravityToRocket
+
+    bool useBarnesHut() const;
+    void storePreviousPositions();
+    void rebaseOrigin();
+    void syncSweepList();
+    bool mergePlanets(int first, int second);
+    void forEachPlanet(const WorkerPool::RangeFunction& fn);
+    void gatherBodies();
+    void scatterVelocities();
+    void scatterState();
+    void buildTrees();
+    void packPlanetSources();
+    void computePlanetAccelerations(bool useTree, bool positionsChanged);
+    void integrateEuler(float deltaTime, bool useTree);
+    void integrateLeapfrog(float deltaTime, bool useTree);
+    void integrateRK4(float deltaTime, bool useTree);
+    void computePlanetAccelerationsExact();
+    void computePlanetAccelerationsBarnesHut();
+    void applyPlanetGravityToRocket(Rocket* rocket, float deltaTime, bool useTree);
+
+public:
+    GravitySimulator(int ownerId = -1);
+
+    void addPlanet(Planet* planet);
+    // Takes the planet out of the simulation without destroying it
+    void removePlanet(Planet* planet);
+    // nullptr if the handle is stale or the planet is not in this simulation
+    Planet* findPlanet(EntityHandle handle) const;
+    void addRocket(Rocket* rocket);
+    void addVehicleManager(VehicleManager* manager) { c = manager; }
+    void update(float deltaTime);
+    void clearRockets();
+    void addRocketGravityInteractions(float deltaTime);
+    void checkPlanetCollisions();
+    // Packs every planet where it is now - call once before a run of applyGravityToRocket
+    void beginReplay();
+    // Pulls one rocket towards the planets packed by beginReplay, without
+    // stepping anything else - client prediction replays its inputs with this,
+    // and the server steps its players the same way so the two agree
+    void applyGravityToRocket(Rocket* rocket, float deltaTime);
+    const std::vector<Planet*>& getPlanets() const { return a; }
+    const BodyStore& getBodies() const { return k; }
+    void setSimulatePlanetGravity(bool enable) { e = enable; }
+
+    // Solver selection - EXACT can be used to validate the Barnes-Hut results
+    void setGravitySolver(GravitySolver solver) { g = solver; }
+    GravitySolver getGravitySolver() const { return g; }
+    void setOpeningAngle(float theta) { h = theta; }
+    float getOpeningAngle() const { return h; }
+
+    // Integrator for planets. Rockets always use semi-implicit Euler because
+    // thrust and surface contact are applied in Rocket::update.
+    void setIntegrator(Integrator integrator) { q = integrator; }
+    Integrator getIntegrator() const { return q; }
+
+    // Floating origin. Floats lose precision far from (0, 0), so the simulation
+    // is kept centred on the active vehicle: once it strays further than
+    // FLOATING_ORIGIN_DISTANCE every object is shifted back. The accumulated
+    // shift is kept in double precision; local + offset is the world position.
+    // Only for simulators that own every object - peers exchange absolute positions.
+    void setFloatingOrigin(bool enable) { t = enable; }
+    bool isFloatingOrigin() const { return t; }
+    void shiftOrigin(sf::Vector2f offset);
+    sf::Vector2<double> getOriginOffset() const { return u; }
+    sf::Vector2<double> toWorldPosition(sf::Vector2f local) const {
+        return sf::Vector2<double>(u.x + local.x, u.y + local.y);
+    }
+
+    // Threads used for the planet force step, including the calling thread.
+    // 1 keeps everything on the caller, 0 uses every hardware thread.
+    void setWorkerThreads(size_t count) { p.setThreadCount(count); }
+    size_t getWorkerThreads() const { return p.getThreadCount(); }
+    int getOwnerId() const { return f; }
+
+    // Only simulate physics for planets/rockets owned by this simulator's owner
+    void setOwnerId(int id) { f = id; }
+    bool shouldSimulateObject(int objectOwnerId) const;
+
+    // Only declare the method, don't implement it here
+    void updateVehicleManagerPlanets();
+
+    void removeVehicleManager(VehicleManager* manager) { if (c == manager) { c = nullptr; } }
 };
\ No newline at end of file
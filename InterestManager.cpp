@@ -0,0 +1,213 @@
+// InterestManager.cpp
+#include "InterestManager.h"
+#include "GameConstants.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <unordered_set>
+
+namespace {
+    // Priority gained per state. Everything inside the near distance earns a
+    // full refresh every state; further out it falls off with distance.
+    float priorityFor(float distance, float relativeSpeed) {
+        float a = std::min(1.0f, GameConstants::INTEREST_NEAR_DISTANCE / std::max(distance, 1.0f));
+        return a * (1.0f + relativeSpeed / GameConstants::INTEREST_SPEED_REFERENCE);
+    }
+
+    float length(sf::Vector2f v) {
+        return std::sqrt(v.x * v.x + v.y * v.y);
+    }
+}
+
+InterestManager::InterestManager()
+    : h(GameConstants::INTEREST_RADIUS)
+{
+    a.a = 0;
+    a.b = 0.0f;
+    a.e = false;
+}
+
+int InterestManager::cellCoordinate(float value) const
+{
+    return static_cast<int>(std::floor(value / h));
+}
+
+int64_t InterestManager::cellKey(int x, int y) const
+{
+    return (static_cast<int64_t>(x) << 32) | static_cast<uint32_t>(y);
+}
+
+void InterestManager::beginTick(const GameState& state)
+{
+    a = state;
+
+    // Sorted (cell, index) lists - rebuilt every tick without reallocating
+    b.clear();
+    for (size_t i = 0; i < a.d.size(); i++) {
+        const sf::Vector2f& p = a.d[i].b;
+        b.emplace_back(cellKey(cellCoordinate(p.x), cellCoordinate(p.y)), static_cast<int>(i));
+    }
+    std::sort(b.begin(), b.end());
+
+    c.clear();
+    for (size_t i = 0; i < a.c.size(); i++) {
+        const sf::Vector2f& p = a.c[i].b;
+        c.emplace_back(cellKey(cellCoordinate(p.x), cellCoordinate(p.y)), static_cast<int>(i));
+    }
+    std::sort(c.begin(), c.end());
+}
+
+void InterestManager::gatherCandidates(ClientView& view, int clientId, sf::Vector2f viewerPos, sf::Vector2f viewerVel)
+{
+    e.clear();
+    const float radius = GameConstants::INTEREST_RADIUS;
+    const int cx = cellCoordinate(viewerPos.x);
+    const int cy = cellCoordinate(viewerPos.y);
+
+    // Cells are as wide as the radius, so the 3x3 block around the viewer covers it
+    for (int y = cy - 1; y <= cy + 1; y++) {
+        for (int x = cx - 1; x <= cx + 1; x++) {
+            const int64_t key = cellKey(x, y);
+
+            auto p = std::lower_bound(b.begin(), b.end(), std::make_pair(key, std::numeric_limits<int>::min()));
+            for (; p != b.end() && p->first == key; ++p) {
+                const PlanetState& planet = a.d[p->second];
+                float distance = length(planet.b - viewerPos) - planet.e;
+                if (distance > radius) continue;
+
+                float& accumulated = view.c[planet.a];
+                accumulated += priorityFor(distance, length(planet.c - viewerVel));
+                e.push_back({ accumulated, p->second, false });
+            }
+
+            auto r = std::lower_bound(c.begin(), c.end(), std::make_pair(key, std::numeric_limits<int>::min()));
+            for (; r != c.end() && r->first == key; ++r) {
+                const RocketState& rocket = a.c[r->second];
+                if (rocket.a == clientId) continue;
+
+                float distance = length(rocket.b - viewerPos);
+                if (distance > radius) continue;
+
+                g[r->second] = 1;
+                float& accumulated = view.d[rocket.a];
+                accumulated += priorityFor(distance, length(rocket.c - viewerVel));
+
+                // A rocket the client does not have yet goes out straight away
+                float priority = view.b.count(rocket.a) ? accumulated : std::numeric_limits<float>::max();
+                e.push_back({ priority, r->second, true });
+            }
+        }
+    }
+}
+
+void InterestManager::buildState(int clientId, sf::Vector2f viewerPos, sf::Vector2f viewerVel, GameState& out)
+{
+    out.a = a.a;
+    out.b = a.b;
+    out.e = a.e;
+    out.c.clear();
+    out.d.clear();
+
+    ClientView& view = d[clientId];
+    f.assign(a.d.size(), 0);
+    g.assign(a.c.size(), 0);
+
+    gatherCandidates(view, clientId, viewerPos, viewerVel);
+
+    // Highest accumulated priority wins the refresh budget
+    size_t budget = std::min(GameConstants::INTEREST_MAX_REFRESH, e.size());
+    std::partial_sort(e.begin(), e.begin() + budget, e.end(),
+        [](const Candidate& x, const Candidate& y) { return x.a > y.a; });
+
+    for (size_t i = 0; i < budget; i++) {
+        if (e[i].c) {
+            g[e[i].b] = 2;
+            view.d[a.c[e[i].b].a] = 0.0f;
+        }
+        else {
+            f[e[i].b] = 1;
+            view.c[a.d[e[i].b].a] = 0.0f;
+        }
+    }
+
+    // Far planets still drift - refresh a few of them every state
+    if (!a.d.empty()) {
+        for (size_t i = 0; i < GameConstants::INTEREST_BACKGROUND_REFRESH && i < a.d.size(); i++) {
+            size_t p = view.e++ % a.d.size();
+            f[p] = 1;
+            view.c[a.d[p].a] = 0.0f;
+        }
+    }
+
+    // Planets - every one, current values only when refreshed or never sent
+    out.d.reserve(a.d.size());
+    for (size_t i = 0; i < a.d.size(); i++) {
+        const PlanetState& planet = a.d[i];
+        auto sent = view.a.find(planet.a);
+
+        if (f[i] || sent == view.a.end()) {
+            view.a[planet.a] = planet;
+            out.d.push_back(planet);
+        }
+        else {
+            out.d.push_back(sent->second);
+        }
+    }
+
+    // Rockets - our own always current, others only inside the radius
+    out.c.reserve(a.c.size());
+    for (size_t i = 0; i < a.c.size(); i++) {
+        const RocketState& rocket = a.c[i];
+
+        if (rocket.a == clientId) {
+            out.c.push_back(rocket);
+            continue;
+        }
+
+        if (!g[i]) {
+            // Outside - forget it so it comes back with current values
+            view.b.erase(rocket.a);
+            view.d.erase(rocket.a);
+            continue;
+        }
+
+        auto sent = view.b.find(rocket.a);
+        if (g[i] == 2 || sent == view.b.end()) {
+            view.b[rocket.a] = rocket;
+            out.c.push_back(rocket);
+        }
+        else {
+            out.c.push_back(sent->second);
+        }
+    }
+
+    // Drop bookkeeping for planets that no longer exist (merged or destroyed)
+    if (view.a.size() > a.d.size()) {
+        std::unordered_set<uint32_t> live;
+        for (const auto& planet : a.d) {
+            live.insert(planet.a);
+        }
+        for (auto it = view.a.begin(); it != view.a.end(); ) {
+            if (live.count(it->first)) {
+                ++it;
+            }
+            else {
+                view.c.erase(it->first);
+                it = view.a.erase(it);
+            }
+        }
+    }
+}
+
+void InterestManager::resetClient(int clientId)
+{
+    auto it = d.find(clientId);
+    if (it != d.end()) {
+        it->second = ClientView();
+    }
+}
+
+void InterestManager::removeClient(int clientId)
+{
+    d.erase(clientId);
+}
@@ -0,0 +1,69 @@
+// InterestManager.h
+#pragma once
+#include "GameState.h"
+#include <SFML/System/Vector2.hpp>
+#include <vector>
+#include <map>
+#include <unordered_map>
+#include <utility>
+#include <cstdint>
+
+// Per-client relevancy for game states. Each client gets its own snapshot:
+//  - its own rocket, always current
+//  - other rockets within INTEREST_RADIUS; further ones are left out
+//  - every planet, because the client simulates their gravity - but only the
+//    ones that win the priority accumulation carry current values. The others
+//    repeat what this client was last sent, which the delta encoder turns into
+//    zero bytes and the client recognises as nothing new.
+//
+// Priority grows every state with closeness and relative speed, so distant or
+// slow bodies wait longer between refreshes. Candidates come from a grid built
+// once per tick, which keeps the per-client work proportional to the number of
+// bodies around the player. Planets outside the radius are refreshed a few per
+// state in round-robin order.
+class InterestManager {
+private:
+    struct ClientView {
+        std::unordered_map<uint32_t, PlanetState> a; // sentPlanets - values this client was last sent
+        std::unordered_map<int, RocketState> b; // sentRockets
+        std::unordered_map<uint32_t, float> c; // planetPriority - accumulated since the last refresh
+        std::unordered_map<int, float> d; // rocketPriority
+        size_t e; // backgroundCursor - next planet index for round-robin refreshes
+
+        ClientView() : e(0) {}
+    };
+
+    struct Candidate {
+        float a; // priority
+        int b; // index into the tick's planet or rocket list
+        bool c; // isRocket
+    };
+
+    GameState a; // tickState - everything, current values
+    std::vector<std::pair<int64_t, int>> b; // planetCells - (cell key, planet index), sorted
+    std::vector<std::pair<int64_t, int>> c; // rocketCells
+    std::map<int, ClientView> d; // clients
+    std::vector<Candidate> e; // candidates - reused between clients
+    std::vector<unsigned char> f; // planetRefresh - per planet, reused between clients
+    std::vector<unsigned char> g; // rocketInterest - per rocket: 0 outside, 1 inside, 2 inside and refreshed
+    float h; // cellSize
+
+    int64_t cellKey(int x, int y) const;
+    int cellCoordinate(float value) const;
+    void gatherCandidates(ClientView& view, int clientId, sf::Vector2f viewerPos, sf::Vector2f viewerVel);
+
+public:
+    InterestManager();
+
+    // Full state for this tick - call once before the buildState() calls
+    void beginTick(const GameState& state);
+
+    // Snapshot tailored to a player standing at viewerPos
+    void buildState(int clientId, sf::Vector2f viewerPos, sf::Vector2f viewerVel, GameState& out);
+
+    // Forget what a client was sent, so its next state refreshes everything
+    void resetClient(int clientId);
+    void removeClient(int clientId);
+
+    unsigned long getTickSequence() const { return a.a; }
+};
@@ -1,96 +1,115 @@
-// NetworkManager.h
-#pragma once
-#include <SFML/Network.hpp>
-#include <vector>
-#include <string>
-#include <functional>
-#include "GameState.h"
-#include "PlayerInput.h"
-
-// Forward declarations
-class GameServer;
-class GameClient;
-
-// Connection state enum
-enum class ConnectionState {
-    DISCONNECTED,
-    CONNECTING,
-    AUTHENTICATING,
-    CONNECTED
-};
-
-// Message types for network communication
-enum class MessageType {
-    GAME_STATE = 1,
-    PLAYER_INPUT = 2,
-    PLAYER_ID = 3,
-    HEARTBEAT = 4,
-    DISCONNECT = 5,
-    CLIENT_SIMULATION = 6,   // New message type for client simulation state
-    SERVER_VALIDATION = 7    // New message type for server validation
-};
-
-class NetworkManager {
-private:
-    bool a; // isHost
-    std::vector<sf::TcpSocket*> b; // clients
-    sf::TcpSocket c; // serverConnection
-    sf::TcpListener d; // listener
-    unsigned short e; // port
-    bool f; // connected
-
-    // References to game components
-    GameServer* g; // gameServer
-    GameClient* h; // gameClient
-
-    // Network diagnostics
-    sf::Clock i; // lastPacketTime
-    int j; // packetLossCounter
-    int k; // pingMs
-
-    // Connection state tracking
-    ConnectionState l; // connectionState
-
-    // New variables for distributed simulation
-    float m; // syncInterval - how often to sync with server
-    sf::Clock n; // syncClock - tracks time since last sync
-    std::map<int, float> o; // clientLastSyncTimes - when each client last sent their simulation
-
-public:
-    NetworkManager();
-    ~NetworkManager();
-
-    // Set references to game components
-    void setGameServer(GameServer* server);
-    void setGameClient(GameClient* client);
-
-    bool hostGame(unsigned short port);
-    bool joinGame(const sf::IpAddress& address, unsigned short port);
-    void disconnect();
-    void update();
-    bool sendGameState(const GameState& state);   // Host only
-    bool sendPlayerInput(const PlayerInput& input); // Client only
-
-    // New methods for distributed simulation
-    bool sendClientSimulation(const GameState& clientState);  // Client sending its simulation
-    bool sendServerValidation(const GameState& validatedState, int clientId);  // Server validation
-
-    // Network robustness improvements
-    void enableRobustNetworking();
-    float getPing() const;
-    int getPacketLoss() const;
-
-    // Sync interval setter/getter
-    void setSyncInterval(float interval) { m = interval; }
-    float getSyncInterval() const { return m; }
-
-    bool isConnected() const { return f; }
-    bool getIsHost() const { return a; }
-    bool isFullyConnected() const { return f && l == ConnectionState::CONNECTED; }
-
-    // Callbacks to be set by the game
-    std::function<void(int clientId, const PlayerInput&)> onPlayerInputReceived;
-    std::function<void(const GameState&)> onGameStateReceived;
-    std::function<void(int clientId, const GameState&)> onClientSimulationReceived;  // New callback
-    std::function<void(const GameState&)> onServerValidationReceived;  // New callback
+// NetworkManager.h
+#pragma once
+#include <SFML/Network.hpp>
+#include <vector>
+#include <string>
+#include <functional>
+#include "GameState.h"
+#include "PlayerInput.h"
+#include "SnapshotDelta.h"
+#include "NetworkThread.h"
+#include <map>
+#include <deque>
+#include <optional>
+#include <cstdint>
+
+// Forward declarations
+class GameServer;
+class GameClient;
+
+// Connection state enum
+enum class ConnectionState {
+    DISCONNECTED,
+    CONNECTING,
+    AUTHENTICATING,
+    CONNECTED
+};
+
+// Game-side half of networking: protocol, delta encoding and the callbacks
+// into GameServer/GameClient. The sockets live on the NetworkThread; update()
+// takes whatever it has received and every send hands it a message.
+class NetworkManager {
+private:
+    bool a; // isHost
+    std::vector<int> b; // clients - server side, ids of the connected clients
+    NetworkThread c; // network - owns the sockets
+    std::map<int, uint32_t> d; // lastInputSequences - server side, newest datagram input applied per client
+    unsigned short e; // port
+    bool f; // connected
+
+    // References to game components
+    GameServer* g; // gameServer
+    GameClient* h; // gameClient
+
+    // Network diagnostics
+    sf::Clock i; // lastPacketTime
+    int j; // packetLossCounter
+    int k; // pingMs
+
+    // Connection state tracking
+    ConnectionState l; // connectionState
+
+    // New variables for distributed simulation
+    float m; // syncInterval - how often to sync with server
+    sf::Clock n; // syncClock - tracks time since last sync
+    std::map<int, float> o; // clientLastSyncTimes - when each client last sent their simulation
+
+    // Delta-compressed game states
+    std::map<int, SnapshotHistory> p; // sentSnapshots - per client, the states we sent and what they acked
+    SnapshotHistory q; // receivedSnapshots - client side, reconstructed states usable as baselines
+    GameState r; // decodedState - client side, reused between packets
+
+    // Client side input redundancy and state ordering
+    std::deque<PlayerInput> s; // recentInputs - resent with every input datagram
+    std::optional<uint32_t> t; // newestStateSequence - older states are stale
+
+    bool sendStateAck(unsigned long sequence, bool valid);
+    bool sendGameStateTo(int clientId, const GameState& state);
+    bool send(int clientId, MessageType type, sf::Packet& payload, bool unreliable = false, bool isState = false);
+    void handleClientConnected(int clientId);
+    void handleClientMessage(NetMessage& message);
+    void handleServerMessage(NetMessage& message);
+    void handleGameState(sf::Packet& packet);
+    void applyStateAck(int clientId, uint32_t sequence, bool valid);
+    void removeClient(int clientId);
+
+public:
+    NetworkManager();
+    ~NetworkManager();
+
+    // Set references to game components
+    void setGameServer(GameServer* server);
+    void setGameClient(GameClient* client);
+
+    bool hostGame(unsigned short port);
+    bool joinGame(const sf::IpAddress& address, unsigned short port);
+    void disconnect();
+    void update();
+    bool sendGameState(const GameState& state);   // Host only - the same state to every client
+    bool sendClientGameStates();                   // Host only - each client gets the state GameServer tailors for it
+    bool sendPlayerInput(const PlayerInput& input); // Client only
+
+    // New methods for distributed simulation
+    bool sendClientSimulation(const GameState& clientState);  // Client sending its simulation
+    bool sendServerValidation(const GameState& validatedState, int clientId);  // Server validation
+
+    // Network robustness improvements
+    void enableRobustNetworking();
+    float getPing() const;
+    int getPacketLoss() const;
+
+    // Sync interval setter/getter
+    void setSyncInterval(float interval) { m = interval; }
+    float getSyncInterval() const { return m; }
+
+    bool isConnected() const { return f; }
+    bool getIsHost() const { return a; }
+    bool isFullyConnected() const { return f && l == ConnectionState::CONNECTED; }
+    bool isUdpEstablished() const { return !a && c.isUdpEstablished(); }
+
+    // Callbacks to be set by the game
+    std::function<void(int clientId, const PlayerInput&)> onPlayerInputReceived;
+    std::function<void(const GameState&)> onGameStateReceived;
+    std::function<void(int clientId, const GameState&)> onClientSimulationReceived;  // New callback
+    std::function<void(const GameState&)> onServerValidationReceived;  // New callback
 };
\ No newline at end of file
@@ -0,0 +1,701 @@
+// NetworkThread.cpp
+#include "NetworkThread.h"
+#include "GameConstants.h"
+#include <chrono>
+#include <iostream>
+#include <iterator>
+#include <random>
+
+namespace {
+    // How often the client repeats its hello until the server echoes it
+    constexpr float UDP_HELLO_INTERVAL = 0.25f;
+    // Caps per wake so one flooding socket cannot starve the others - the
+    // selector reports it ready again straight away, so nothing backs up
+    constexpr int MAX_DATAGRAMS_PER_WAKE = 256;
+    constexpr int MAX_PACKETS_PER_WAKE = 256;
+    constexpr size_t DATAGRAM_HEADER_SIZE = 16;
+    // Bigger datagrams get IP-fragmented, and losing any fragment loses the
+    // whole message - keep them inside a typical path MTU and send the rest over TCP
+    constexpr size_t MAX_DATAGRAM_SIZE = 1200;
+    // A batch bigger than this goes to the send queue before more is added
+    constexpr size_t MAX_BATCH_SIZE = 16 * 1024;
+    constexpr size_t BATCH_ENTRY_HEADER_SIZE = 8;
+
+    // Packets store integers in network byte order
+    uint32_t readUint32(const unsigned char* a) {
+        return (static_cast<uint32_t>(a[0]) << 24) | (static_cast<uint32_t>(a[1]) << 16) |
+            (static_cast<uint32_t>(a[2]) << 8) | static_cast<uint32_t>(a[3]);
+    }
+
+    uint32_t makeToken() {
+        static std::mt19937 a(std::random_device{}());
+        uint32_t b;
+        do {
+            b = a();
+        } while (b == 0);
+        return b;
+    }
+}
+
+NetworkThread::NetworkThread()
+    : b(false), // running
+    c(false), // isHost
+    i(1), // nextClientId
+    j(0), // localClientId
+    l(GameConstants::NETWORK_QUEUE_CAPACITY), // inbox
+    m(GameConstants::NETWORK_QUEUE_CAPACITY), // outbox
+    n(false), // udpEstablished
+    o(0), // sendFailures
+    r(false), // wakePending
+    s(false) // inboxWaiting
+{
+}
+
+NetworkThread::~NetworkThread()
+{
+    try {
+        stop();
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Exception in NetworkThread destructor: " << e.what() << std::endl;
+    }
+}
+
+bool NetworkThread::startHost(unsigned short port)
+{
+    stop();
+    c = true;
+
+    if (d.listen(port) != sf::Socket::Status::Done) {
+        std::cerr << "Failed to bind to port " << port << std::endl;
+        return false;
+    }
+    d.setBlocking(false);
+
+    // States and inputs use UDP on the same port number
+    if (e.bind(port) != sf::Socket::Status::Done) {
+        std::cerr << "Failed to bind UDP port " << port << ", game states will use TCP only" << std::endl;
+    }
+    e.setBlocking(false);
+
+    f.clear();
+    f.add(d);
+    if (e.getLocalPort() != 0) {
+        f.add(e);
+    }
+    openWakeSocket();
+    i = 1;
+    o = 0;
+
+    b.store(true, std::memory_order_release);
+    a = std::thread(&NetworkThread::run, this);
+    return true;
+}
+
+bool NetworkThread::startClient(const sf::IpAddress& address, unsigned short port)
+{
+    stop();
+    c = false;
+
+    // The hello goes out once PLAYER_ID brings our id and token
+    h = Peer();
+    h.a = address;
+    h.b = port;
+    h.g = std::make_unique<sf::TcpSocket>();
+
+    // Set a timeout for connection attempts
+    h.g->setBlocking(true);
+    sf::Socket::Status status = h.g->connect(address, port, sf::seconds(5));
+    h.g->setBlocking(false);
+
+    if (status != sf::Socket::Status::Done) {
+        h = Peer();
+        return false;
+    }
+
+    if (e.bind(sf::Socket::AnyPort) != sf::Socket::Status::Done) {
+        std::cerr << "Failed to bind a UDP port, game states will use TCP only" << std::endl;
+    }
+    e.setBlocking(false);
+
+    f.clear();
+    f.add(*h.g);
+    if (e.getLocalPort() != 0) {
+        f.add(e);
+    }
+    openWakeSocket();
+    j = 0;
+    n = false;
+    o = 0;
+
+    b.store(true, std::memory_order_release);
+    a = std::thread(&NetworkThread::run, this);
+    return true;
+}
+
+void NetworkThread::stop()
+{
+    b.store(false, std::memory_order_release);
+    if (a.joinable()) {
+        // Get the thread out of the selector or out of waiting for inbox space
+        wake();
+        {
+            std::lock_guard<std::mutex> lock(t);
+        }
+        u.notify_all();
+        a.join();
+    }
+
+    // The thread is gone, so its sockets can be used from here
+    sf::Packet disconnectPacket;
+    disconnectPacket << static_cast<uint32_t>(static_cast<int>(MessageType::DISCONNECT));
+
+    if (c) {
+        d.close();
+        for (auto& entry : g) {
+            if (entry.second.g) {
+                entry.second.g->send(disconnectPacket);
+                entry.second.g->disconnect();
+            }
+        }
+        g.clear();
+    }
+    else if (h.g) {
+        h.g->send(disconnectPacket);
+        h.g->disconnect();
+    }
+
+    h = Peer();
+    j = 0;
+    n = false;
+    e.unbind();
+    q.unbind();
+    r = false;
+    f.clear();
+    l.clear();
+    m.clear();
+}
+
+bool NetworkThread::send(NetMessage&& message)
+{
+    if (!m.push(std::move(message))) {
+        return false;
+    }
+    wake();
+    return true;
+}
+
+bool NetworkThread::receive(NetMessage& message)
+{
+    if (!l.pop(message)) {
+        return false;
+    }
+
+    // Pairs with the fence in waitForInbox - either the thread sees the room
+    // made here, or this sees that it is waiting
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (s.load(std::memory_order_relaxed)) {
+        std::lock_guard<std::mutex> lock(t);
+        u.notify_one();
+    }
+    return true;
+}
+
+void NetworkThread::openWakeSocket()
+{
+    r = false;
+    if (q.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) != sf::Socket::Status::Done) {
+        std::cerr << "Failed to bind the wake socket, queued messages will wait for the network timeout" << std::endl;
+        return;
+    }
+    q.setBlocking(false);
+    f.add(q);
+}
+
+void NetworkThread::wake()
+{
+    // One datagram until the thread next drains the outbox - it clears r first
+    if (r.exchange(true, std::memory_order_acq_rel)) {
+        return;
+    }
+
+    const unsigned short port = q.getLocalPort();
+    const unsigned char a = 0;
+    if (port == 0 || q.send(&a, sizeof(a), sf::IpAddress::LocalHost, port) != sf::Socket::Status::Done) {
+        r.store(false, std::memory_order_release); // The timeout picks the message up instead
+    }
+}
+
+void NetworkThread::drainWakeSocket()
+{
+    // The datagrams carry nothing, the outbox was drained at the top of run()
+    unsigned char a[16];
+    std::size_t received = 0;
+    std::optional<sf::IpAddress> sender;
+    unsigned short senderPort = 0;
+    for (int count = 0; count < MAX_DATAGRAMS_PER_WAKE; count++) {
+        if (q.receive(a, sizeof(a), received, sender, senderPort) != sf::Socket::Status::Done) {
+            break;
+        }
+    }
+}
+
+void NetworkThread::waitForInbox(sf::Time timeout)
+{
+    std::unique_lock<std::mutex> lock(t);
+    s.store(true, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    u.wait_for(lock, std::chrono::microseconds(timeout.asMicroseconds()), [this] {
+        return !l.full() || !b.load(std::memory_order_acquire);
+    });
+    s.store(false, std::memory_order_relaxed);
+}
+
+void NetworkThread::run()
+{
+    const sf::Time timeout = sf::seconds(GameConstants::NETWORK_WAIT_TIMEOUT);
+
+    while (b.load(std::memory_order_acquire)) {
+        try {
+            // What the game thread queued goes out first, one packet per peer.
+            // Clearing r first means a send() after this point wakes us again.
+            r.exchange(false, std::memory_order_acq_rel);
+            sendOutgoing();
+            flushSendQueues();
+
+            // Until the server echoes our hello, states and inputs keep using TCP
+            if (!c && j != 0 && h.c != 0 && !h.f && k.getElapsedTime().asSeconds() >= UDP_HELLO_INTERVAL) {
+                sendDatagram(h, MessageType::UDP_HELLO, j, sf::Packet());
+                k.restart();
+            }
+
+            // The game thread is behind - leave the data in the sockets until receive() makes room
+            if (l.full()) {
+                waitForInbox(timeout);
+                continue;
+            }
+
+            if (!f.wait(timeout)) {
+                continue;
+            }
+
+            if (q.getLocalPort() != 0 && f.isReady(q)) {
+                drainWakeSocket();
+            }
+
+            if (e.getLocalPort() != 0 && f.isReady(e)) {
+                receiveDatagrams();
+            }
+
+            if (c) {
+                if (f.isReady(d)) {
+                    acceptClient();
+                }
+
+                // Reading can close a client, which removes it from g
+                p.clear();
+                for (auto& entry : g) {
+                    if (entry.second.g && f.isReady(*entry.second.g)) {
+                        p.push_back(entry.first);
+                    }
+                }
+                for (int clientId : p) {
+                    auto peer = g.find(clientId);
+                    if (peer != g.end()) {
+                        receiveFromClient(clientId, peer->second);
+                    }
+                }
+            }
+            else if (h.g && f.isReady(*h.g)) {
+                receiveFromServer();
+            }
+        }
+        catch (const std::exception& e) {
+            std::cerr << "Exception in network thread: " << e.what() << std::endl;
+        }
+    }
+}
+
+void NetworkThread::sendOutgoing()
+{
+    NetMessage a;
+    while (m.pop(a)) {
+        route(a);
+    }
+}
+
+void NetworkThread::route(NetMessage& message)
+{
+    Peer* a = &h;
+    if (c) {
+        auto peer = g.find(message.b);
+        if (peer == g.end()) {
+            return; // Client already gone
+        }
+        a = &peer->second;
+    }
+    if (!a->g) return;
+
+    // Over UDP a lost message is simply superseded by the next one. TCP is
+    // the fallback until the channel is up, and for anything that would not
+    // fit one unfragmented datagram, such as a full state with many planets.
+    if (message.e && a->f && message.d.getDataSize() + DATAGRAM_HEADER_SIZE <= MAX_DATAGRAM_SIZE) {
+        sendDatagram(*a, message.c, c ? message.b : j, message.d);
+        return;
+    }
+
+    queueReliable(*a, message.c, message.d, message.f);
+}
+
+bool NetworkThread::sendDatagram(Peer& peer, MessageType type, int clientId, const sf::Packet& payload)
+{
+    if (!peer.a) return false;
+
+    try {
+        sf::Packet packet;
+        packet << static_cast<uint32_t>(static_cast<int>(type)) << static_cast<uint32_t>(clientId)
+            << peer.c << ++peer.d;
+        packet.append(payload.getData(), payload.getDataSize());
+
+        sf::Socket::Status status = e.send(packet, *peer.a, peer.b);
+        if (status != sf::Socket::Status::Done) {
+            o++;
+            return false;
+        }
+
+        return true;
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Exception in sendDatagram: " << e.what() << std::endl;
+        return false;
+    }
+}
+
+void NetworkThread::queueReliable(Peer& peer, MessageType type, const sf::Packet& payload, bool isState)
+{
+    // An oversized batch is handed over first. Its peer stays - the queue
+    // limits are far above the batch size, so a dropped client shows up on the next flush.
+    if (peer.i.getDataSize() > 0 &&
+        peer.i.getDataSize() + BATCH_ENTRY_HEADER_SIZE + payload.getDataSize() > MAX_BATCH_SIZE) {
+        if (!peer.h.push(peer.i, peer.j)) {
+            o++;
+        }
+        peer.i.clear();
+    }
+
+    if (peer.i.getDataSize() == 0) {
+        peer.i << static_cast<uint32_t>(static_cast<int>(MessageType::BATCH));
+        peer.j = true;
+    }
+
+    peer.i << static_cast<uint32_t>(static_cast<int>(type)) << static_cast<uint32_t>(payload.getDataSize());
+    peer.i.append(payload.getData(), payload.getDataSize());
+    peer.j = peer.j && isState;
+}
+
+bool NetworkThread::flushBatch(int clientId, Peer& peer)
+{
+    if (peer.i.getDataSize() == 0) return true;
+
+    bool pushed = peer.h.push(peer.i, peer.j);
+    peer.i.clear();
+
+    // One slow client must not hold up the rest - past the limit it is dropped
+    if (!pushed) {
+        if (c) {
+            std::cerr << "Client " << clientId << " is not keeping up (" << peer.h.getQueuedBytes()
+                << " bytes queued), disconnecting it" << std::endl;
+            closeClient(clientId);
+            return false;
+        }
+
+        std::cerr << "Server is not taking data (" << peer.h.getQueuedBytes() << " bytes queued), dropping messages" << std::endl;
+        o++;
+    }
+    return true;
+}
+
+void NetworkThread::flushSendQueues()
+{
+    // One send per peer for everything routed this pass. Failed sockets are
+    // picked up by the receive paths, which see the disconnect.
+    if (c) {
+        for (auto entry = g.begin(); entry != g.end(); ) {
+            // flushBatch may close the client, which erases only this entry
+            auto next = std::next(entry);
+            Peer& peer = entry->second;
+            if (flushBatch(entry->first, peer) && peer.g && !peer.h.empty()) {
+                sf::Socket::Status status = peer.h.flush(*peer.g);
+                if (status == sf::Socket::Status::Error) {
+                    o++;
+                }
+            }
+            entry = next;
+        }
+    }
+    else if (h.g) {
+        flushBatch(0, h);
+        if (!h.h.empty() && h.h.flush(*h.g) == sf::Socket::Status::Error) {
+            o++;
+        }
+    }
+}
+
+void NetworkThread::acceptClient()
+{
+    auto a = std::make_unique<sf::TcpSocket>();
+    if (d.accept(*a) != sf::Socket::Status::Done) {
+        return;
+    }
+    a->setBlocking(false);
+
+    // Log connection info
+    if (auto remoteAddress = a->getRemoteAddress()) {
+        std::cout << "New client connecting from: " << remoteAddress->toString() << std::endl;
+    }
+    else {
+        std::cout << "New client connecting from: unknown address" << std::endl;
+    }
+
+    int clientId = i++;
+    Peer& peer = g[clientId];
+    peer.g = std::move(a);
+    f.add(*peer.g);
+
+    // The game thread adds the player before it sees anything the client sends
+    NetMessage connected;
+    connected.a = NetEvent::CONNECTED;
+    connected.b = clientId;
+    post(std::move(connected));
+
+    // The token authenticates the client's datagrams
+    peer.c = makeToken();
+    sf::Packet payload;
+    payload << static_cast<uint32_t>(clientId) << peer.c;
+    queueReliable(peer, MessageType::PLAYER_ID, payload, false);
+}
+
+void NetworkThread::receiveDatagrams()
+{
+    for (int count = 0; count < MAX_DATAGRAMS_PER_WAKE && !l.full(); count++) {
+        NetMessage message;
+        std::optional<sf::IpAddress> sender;
+        unsigned short senderPort = 0;
+        if (e.receive(message.d, sender, senderPort) != sf::Socket::Status::Done) {
+            break;
+        }
+
+        try {
+            uint32_t msgType, clientId, token, sequence;
+            if (!sender || !(message.d >> msgType >> clientId >> token >> sequence)) {
+                continue;
+            }
+            message.b = c ? static_cast<int>(clientId) : 0;
+            message.c = static_cast<MessageType>(msgType);
+            message.e = true;
+
+            if (c) {
+                auto it = g.find(static_cast<int>(clientId));
+                if (it == g.end() || it->second.c != token) {
+                    continue; // Unknown client or forged datagram
+                }
+                Peer& peer = it->second;
+
+                if (message.c == MessageType::UDP_HELLO) {
+                    // Take the endpoint from the hello itself - behind NAT it differs from the TCP one
+                    peer.a = sender;
+                    peer.b = senderPort;
+                    sendDatagram(peer, MessageType::UDP_HELLO, static_cast<int>(clientId), sf::Packet());
+                    continue;
+                }
+
+                if (!peer.a || !(*peer.a == *sender) || peer.b != senderPort) continue;
+                if (!isNewerSequence(sequence, peer.e)) continue; // Late or duplicate
+                peer.e = sequence;
+
+                // The client only switches over after hearing our echo, so both directions work
+                if (!peer.f) {
+                    peer.f = true;
+                    std::cout << "UDP channel established with client " << clientId << std::endl;
+                }
+            }
+            else {
+                if (!h.a || !(*h.a == *sender) || h.b != senderPort) continue;
+                if (static_cast<int>(clientId) != j || token != h.c) continue;
+                if (!isNewerSequence(sequence, h.e)) continue; // Late or duplicate
+                h.e = sequence;
+
+                if (!h.f) {
+                    h.f = true;
+                    n.store(true, std::memory_order_release);
+                    std::cout << "UDP channel established with server" << std::endl;
+                }
+
+                // Echo of our hello - nothing else to do
+                if (message.c == MessageType::UDP_HELLO) continue;
+            }
+
+            post(std::move(message));
+        }
+        catch (const std::exception& e) {
+            std::cerr << "Exception processing datagram: " << e.what() << std::endl;
+        }
+    }
+}
+
+void NetworkThread::receiveFromClient(int clientId, Peer& peer)
+{
+    // Everything the socket has, not one packet per wake, so a backlog cannot build up
+    for (int count = 0; count < MAX_PACKETS_PER_WAKE; count++) {
+        sf::Packet packet;
+        sf::Socket::Status status = peer.g->receive(packet);
+
+        if (status == sf::Socket::Status::Disconnected) {
+            std::cout << "Client " << clientId << " disconnected" << std::endl;
+            closeClient(clientId);
+            return;
+        }
+        if (status != sf::Socket::Status::Done) {
+            return;
+        }
+        if (!receivePacket(clientId, packet)) {
+            return;
+        }
+    }
+}
+
+void NetworkThread::receiveFromServer()
+{
+    for (int count = 0; count < MAX_PACKETS_PER_WAKE; count++) {
+        sf::Packet packet;
+        sf::Socket::Status status = h.g->receive(packet);
+
+        if (status == sf::Socket::Status::Disconnected) {
+            std::cout << "Lost connection to server" << std::endl;
+            closeServer();
+            return;
+        }
+        if (status != sf::Socket::Status::Done) {
+            return;
+        }
+        if (!receivePacket(0, packet)) {
+            return;
+        }
+    }
+}
+
+bool NetworkThread::receivePacket(int clientId, sf::Packet& packet)
+{
+    uint32_t msgType;
+    if (packet.getDataSize() == 0 || !(packet >> msgType)) {
+        std::cerr << "Failed to read message type from packet" << std::endl;
+        return true;
+    }
+
+    if (static_cast<MessageType>(msgType) != MessageType::BATCH) {
+        NetMessage message;
+        message.c = static_cast<MessageType>(msgType);
+        message.d = std::move(packet);
+        return handleReliable(clientId, message);
+    }
+
+    // Split the batch back into its messages, in the order they were sent
+    const unsigned char* data = static_cast<const unsigned char*>(packet.getData());
+    size_t offset = packet.getReadPosition();
+    const size_t end = packet.getDataSize();
+
+    while (offset + BATCH_ENTRY_HEADER_SIZE <= end) {
+        uint32_t type = readUint32(data + offset);
+        uint32_t size = readUint32(data + offset + 4);
+        offset += BATCH_ENTRY_HEADER_SIZE;
+        if (size > end - offset) {
+            std::cerr << "Truncated message in batch" << std::endl;
+            break;
+        }
+
+        NetMessage message;
+        message.c = static_cast<MessageType>(type);
+        message.d.append(data + offset, size);
+        offset += size;
+
+        if (!handleReliable(clientId, message)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool NetworkThread::handleReliable(int clientId, NetMessage& message)
+{
+    message.b = clientId;
+
+    if (c) {
+        if (message.c == MessageType::DISCONNECT) {
+            std::cout << "Client " << clientId << " requested disconnect" << std::endl;
+            closeClient(clientId);
+            return false;
+        }
+    }
+    else if (message.c == MessageType::PLAYER_ID) {
+        // Our id and token address the datagram channel. Servers without
+        // one send no token. The game thread reads the id again.
+        sf::Packet peek = message.d;
+        uint32_t playerId, token;
+        if (peek >> playerId >> token) {
+            j = static_cast<int>(playerId);
+            h.c = token;
+            k.restart();
+        }
+    }
+    else if (message.c == MessageType::DISCONNECT) {
+        std::cout << "Disconnected from server" << std::endl;
+        closeServer();
+        return false;
+    }
+
+    post(std::move(message));
+    return true;
+}
+
+bool NetworkThread::post(NetMessage&& message)
+{
+    // Only datagrams may be lost - TCP messages and connection events wait
+    // for the game thread to make room
+    while (!l.push(std::move(message))) {
+        if (message.e || !b.load(std::memory_order_acquire)) {
+            return false;
+        }
+        waitForInbox(sf::seconds(GameConstants::NETWORK_WAIT_TIMEOUT));
+    }
+    return true;
+}
+
+void NetworkThread::closeClient(int clientId)
+{
+    auto peer = g.find(clientId);
+    if (peer == g.end()) return;
+
+    if (peer->second.g) {
+        f.remove(*peer->second.g);
+        peer->second.g->disconnect();
+    }
+    g.erase(peer);
+
+    NetMessage disconnected;
+    disconnected.a = NetEvent::DISCONNECTED;
+    disconnected.b = clientId;
+    post(std::move(disconnected));
+}
+
+void NetworkThread::closeServer()
+{
+    if (!h.g) return;
+
+    f.remove(*h.g);
+    h.g->disconnect();
+    h.g.reset();
+
+    NetMessage disconnected;
+    disconnected.a = NetEvent::DISCONNECTED;
+    post(std::move(disconnected));
+}
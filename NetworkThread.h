@@ -0,0 +1,150 @@
+// NetworkThread.h
+#pragma once
+#include <SFML/Network.hpp>
+#include "SendQueue.h"
+#include "SpscQueue.h"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <map>
+#include <vector>
+#include <memory>
+#include <optional>
+#include <cstdint>
+
+// Message types for network communication
+enum class MessageType {
+    GAME_STATE = 1,
+    PLAYER_INPUT = 2,
+    PLAYER_ID = 3,
+    HEARTBEAT = 4,
+    DISCONNECT = 5,
+    CLIENT_SIMULATION = 6,   // New message type for client simulation state
+    SERVER_VALIDATION = 7,   // New message type for server validation
+    STATE_ACK = 8,           // Client confirms a game state, which becomes its delta baseline
+    UDP_HELLO = 9,           // Registers the client's datagram endpoint, echoed back by the server
+    BATCH = 10               // Several TCP messages in one packet, each as type, size and payload
+};
+
+// What a message from the network thread is about
+enum class NetEvent {
+    MESSAGE,      // A message arrived
+    CONNECTED,    // Server side - a client connected and was sent its id
+    DISCONNECTED  // A client (server side) or the server (client side) is gone
+};
+
+// True if sequence a comes after b, allowing for wrap-around
+inline bool isNewerSequence(uint32_t a, uint32_t b) {
+    return static_cast<int32_t>(a - b) > 0;
+}
+
+// One message between the game thread and the network thread
+struct NetMessage {
+    NetEvent a; // event
+    int b; // clientId - server side, the client it came from or goes to
+    MessageType c; // type
+    sf::Packet d; // payload - the read position is past the type and any datagram header
+    bool e; // unreliable - incoming: came as a datagram, outgoing: may go as one once the channel is up
+    bool f; // isState - outgoing TCP, may be coalesced with a queued state
+
+    NetMessage() : a(NetEvent::MESSAGE), b(0), c(MessageType::HEARTBEAT), e(false), f(false) {}
+};
+
+// The other end of a connection. Game states, inputs and acks go over UDP
+// once it works both ways, everything else stays on TCP. Every datagram
+// carries the sender's client id, the token handed out with PLAYER_ID and a
+// sequence number; anything older than the newest datagram already received
+// from that peer is dropped. TCP messages routed in the same pass are batched
+// into one packet, which then goes through the peer's send queue.
+struct Peer {
+    std::optional<sf::IpAddress> a; // address - unset until known
+    unsigned short b; // port
+    uint32_t c; // token
+    uint32_t d; // outgoingSequence
+    uint32_t e; // newestIncomingSequence
+    bool f; // established - a datagram other than the hello came through
+    std::unique_ptr<sf::TcpSocket> g; // socket
+    SendQueue h; // reliableQueue - TCP packets the socket has not taken yet
+    sf::Packet i; // batch - TCP messages not yet handed to the send queue
+    bool j; // batchIsState - the batch holds nothing but game states, so the queue may coalesce it
+
+    Peer() : b(0), c(0), d(0), e(0), f(false), j(false) {}
+};
+
+// Owns every socket and does all network I/O on its own thread, so a long
+// frame does not hold up packets and a burst of packets does not stall a
+// frame. The thread sleeps in a SocketSelector until a socket has data (or
+// NETWORK_WAIT_TIMEOUT passes), drains every ready socket, and hands the
+// messages to the game thread through a lock-free queue; messages the game
+// thread sends come back the same way. Each queue has exactly one producer and one
+// consumer. send() wakes the selector with a datagram to a loopback socket, and
+// when the inbox is full the thread waits on a condition variable that
+// receive() signals, so neither side polls.
+class NetworkThread {
+private:
+    std::thread a; // thread
+    std::atomic<bool> b; // running
+    bool c; // isHost
+    sf::TcpListener d; // listener - server side
+    sf::UdpSocket e; // udpSocket
+    sf::SocketSelector f; // selector - every socket the thread reads from
+    std::map<int, Peer> g; // clientPeers - server side, by client id
+    Peer h; // serverPeer - client side
+    int i; // nextClientId - server side, ids are never reused
+    int j; // localClientId - client side, 0 until PLAYER_ID arrives
+    sf::Clock k; // udpHelloClock
+    SpscQueue<NetMessage> l; // inbox - network thread to game thread
+    SpscQueue<NetMessage> m; // outbox - game thread to network thread
+    std::atomic<bool> n; // udpEstablished - client side, h.f for the game thread
+    std::atomic<int> o; // sendFailures
+    std::vector<int> p; // readyClients - reused between wakes
+    sf::UdpSocket q; // wakeSocket - bound to localhost, send() writes to it from the game thread
+    std::atomic<bool> r; // wakePending - a wake datagram is on its way, no need for another
+    std::atomic<bool> s; // inboxWaiting - the thread waits in u for the game thread to make room
+    std::mutex t; // inboxMutex
+    std::condition_variable u; // inboxSpace
+
+    void run();
+    void openWakeSocket();
+    void wake();
+    void drainWakeSocket();
+    void waitForInbox(sf::Time timeout);
+    void sendOutgoing();
+    void route(NetMessage& message);
+    bool sendDatagram(Peer& peer, MessageType type, int clientId, const sf::Packet& payload);
+    void queueReliable(Peer& peer, MessageType type, const sf::Packet& payload, bool isState);
+    bool flushBatch(int clientId, Peer& peer);
+    void flushSendQueues();
+    void acceptClient();
+    void receiveDatagrams();
+    void receiveFromClient(int clientId, Peer& peer);
+    void receiveFromServer();
+    bool receivePacket(int clientId, sf::Packet& packet);
+    bool handleReliable(int clientId, NetMessage& message);
+    bool post(NetMessage&& message);
+    void closeClient(int clientId);
+    void closeServer();
+
+public:
+    NetworkThread();
+    ~NetworkThread();
+
+    NetworkThread(const NetworkThread&) = delete;
+    NetworkThread& operator=(const NetworkThread&) = delete;
+
+    // Binds the listener and the UDP socket, then starts the thread
+    bool startHost(unsigned short port);
+    // Connects (blocking for up to 5 seconds), then starts the thread
+    bool startClient(const sf::IpAddress& address, unsigned short port);
+    // Joins the thread, tells every peer we are leaving and closes all sockets
+    void stop();
+
+    // Game thread side. send() fails when the outbox is full.
+    bool send(NetMessage&& message);
+    bool receive(NetMessage& message);
+
+    bool isRunning() const { return b.load(std::memory_order_acquire); }
+    bool isUdpEstablished() const { return n.load(std::memory_order_acquire); }
+    int getSendFailures() const { return o.load(std::memory_order_relaxed); }
+};
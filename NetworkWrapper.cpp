@@ -1,181 +1,225 @@
-// NetworkWrapper.cpp
-#include "NetworkWrapper.h"
-#include "GameServer.h"
-#include "GameClient.h"
-#include <iostream>
-
-NetworkWrapper::NetworkWrapper()
-    : gameServer(nullptr),
-    gameClient(nullptr),
-    isMultiplayer(false),
-    isHost(false)
-{
-    // Initialize components
-}
-
-NetworkWrapper::~NetworkWrapper()
-{
-    try {
-        // First disconnect network to stop any threads
-        if (networkManager.isConnected()) {
-            networkManager.disconnect();
-        }
-
-        // Then clean up resources
-        if (gameServer) {
-            delete gameServer;
-            gameServer = nullptr;
-        }
-
-        if (gameClient) {
-            delete gameClient;
-            gameClient = nullptr;
-        }
-    }
-    catch (const std::exception& e) {
-        std::cerr << "Exception in NetworkWrapper destructor: " << e.what() << std::endl;
-    }
-    catch (...) {
-        std::cerr << "Unknown exception in NetworkWrapper destructor" << std::endl;
-    }
-}
-
-bool NetworkWrapper::initialize(bool host, const std::string& address, unsigned short port)
-{
-    try {
-        isMultiplayer = true;
-        isHost = host;
-
-        std::cout << "Initializing network in " << (host ? "host" : "client") << " mode..." << std::endl;
-
-        if (host) {
-            // Server mode
-            try {
-                gameServer = new GameServer();
-                if (!networkManager.hostGame(port)) {
-                    std::cerr << "Failed to start server on port " << port << std::endl;
-                    delete gameServer;
-                    gameServer = nullptr;
-                    return false;
-                }
-                networkManager.setGameServer(gameServer);
-                std::cout << "Server started successfully!" << std::endl;
-            }
-            catch (const std::exception& e) {
-                std::cerr << "Exception creating GameServer: " << e.what() << std::endl;
-                delete gameServer;
-                gameServer = nullptr;
-                return false;
-            }
-        }
-        else {
-            // Client mode
-            try {
-                gameClient = new GameClient();
-                gameClient->initialize();
-
-                std::cout << "Connecting to " << address << ":" << port << "..." << std::endl;
-
-                // Convert string address to IpAddress
-                auto serverAddressOpt = sf::IpAddress::resolve(address);
-                if (!serverAddressOpt) {
-                    std::cerr << "Failed to resolve address: " << address << std::endl;
-                    delete gameClient;
-                    gameClient = nullptr;
-                    return false;
-                }
-
-                if (!networkManager.joinGame(*serverAddressOpt, port)) {
-                    std::cerr << "Failed to connect to server" << std::endl;
-                    delete gameClient;
-                    gameClient = nullptr;
-                    return false;
-                }
-
-                // Set up callback for game state processing
-                networkManager.onGameStateReceived = [this](const GameState& state) {
-                    if (gameClient) {
-                        try {
-                            gameClient->processGameState(state);
-                        }
-                        catch (const std::exception& e) {
-                            std::cerr << "Exception processing game state: " << e.what() << std::endl;
-                        }
-                    }
-                    };
-
-                networkManager.setGameClient(gameClient);
-                std::cout << "Successfully connected to server!" << std::endl;
-                std::cout << "Network connection established." << std::endl;
-            }
-            catch (const std::exception& e) {
-                std::cerr << "Exception creating GameClient: " << e.what() << std::endl;
-                delete gameClient;
-                gameClient = nullptr;
-                return false;
-            }
-        }
-
-        return true;
-    }
-    catch (const std::exception& e) {
-        std::cerr << "Exception in initialize: " << e.what() << std::endl;
-        // Clean up any partially initialized resources
-        delete gameServer;
-        gameServer = nullptr;
-        delete gameClient;
-        gameClient = nullptr;
-        return false;
-    }
-    catch (...) {
-        std::cerr << "Unknown exception in initialize" << std::endl;
-        // Clean up any partially initialized resources
-        delete gameServer;
-        gameServer = nullptr;
-        delete gameClient;
-        gameClient = nullptr;
-        return false;
-    }
-}
-
-
-void NetworkWrapper::update(float deltaTime)
-{
-    try {
-        // Update network manager
-        networkManager.update();
-
-        // Update game components based on connection state
-        if (isHost && gameServer) {
-            gameServer->update(deltaTime);
-
-            // Send game state to clients
-            networkManager.sendGameState(gameServer->getGameState());
-        }
-        else if (!isHost && gameClient) {
-            // Check if we've received a player ID yet
-            if (gameClient->getLocalPlayerId() > 0) {
-                // We have an ID, check if we're fully connected
-                if (gameClient->isConnected()) {
-                    // Fully connected, update normally
-                    gameClient->update(deltaTime);
-                }
-                else if (gameClient->isWaitingForState()) {
-                    // Waiting for initial state, don't update yet
-                    // but could add a timeout check here
-                    std::cout << "Waiting for initial game state..." << std::endl;
-                }
-            }
-            else {
-                // Still waiting for player ID
-                std::cout << "Waiting for player ID from server..." << std::endl;
-            }
-        }
-    }
-    catch (const std::exception& e) {
-        std::cerr << "Exception in NetworkWrapper::update: " << e.what() << std::endl;
-    }
-    catch (...) {
-        std::cerr << "Unknown exception in NetworkWrapper::update" << std::endl;
-    }
-}
+// NetworkWrapper.cpp
+#include "NetworkWrapper.h"
+#include "GameServer.h"
+#include "GameClient.h"
+#include "GameConstants.h"
+#include <iostream>
+#include <cmath>
+
+NetworkWrapper::NetworkWrapper()
+    : gameServer(nullptr),
+    gameClient(nullptr),
+    isMultiplayer(false),
+    isHost(false),
+    snapshotInterval(1.0f / GameConstants::SNAPSHOT_RATE),
+    snapshotAccumulator(0.0f)
+{
+    // Initialize components
+}
+
+NetworkWrapper::~NetworkWrapper()
+{
+    try {
+        // First disconnect network to stop any threads
+        if (networkManager.isConnected()) {
+            networkManager.disconnect();
+        }
+
+        // Then clean up resources
+        if (gameServer) {
+            delete gameServer;
+            gameServer = nullptr;
+        }
+
+        if (gameClient) {
+            delete gameClient;
+            gameClient = nullptr;
+        }
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Exception in NetworkWrapper destructor: " << e.what() << std::endl;
+    }
+    catch (...) {
+        std::cerr << "Unknown exception in NetworkWrapper destructor" << std::endl;
+    }
+}
+
+bool NetworkWrapper::initialize(bool host, const std::string& address, unsigned short port)
+{
+    try {
+        isMultiplayer = true;
+        isHost = host;
+
+        std::cout << "Initializing network in " << (host ? "host" : "client") << " mode..." << std::endl;
+
+        if (host) {
+            // Server mode
+            try {
+                gameServer = new GameServer();
+                if (!networkManager.hostGame(port)) {
+                    std::cerr << "Failed to start server on port " << port << std::endl;
+                    delete gameServer;
+                    gameServer = nullptr;
+                    return false;
+                }
+                networkManager.setGameServer(gameServer);
+                // Client inputs join the player's queue, applied one per tick
+                networkManager.onPlayerInputReceived = [this](int clientId, const PlayerInput& input) {
+                    if (gameServer) {
+                        gameServer->handlePlayerInput(clientId, input);
+                    }
+                };
+                std::cout << "Server started successfully!" << std::endl;
+            }
+            catch (const std::exception& e) {
+                std::cerr << "Exception creating GameServer: " << e.what() << std::endl;
+                delete gameServer;
+                gameServer = nullptr;
+                return false;
+            }
+        }
+        else {
+            // Client mode
+            try {
+                gameClient = new GameClient();
+                gameClient->initialize();
+
+                std::cout << "Connecting to " << address << ":" << port << "..." << std::endl;
+
+                // Convert string address to IpAddress
+                auto serverAddressOpt = sf::IpAddress::resolve(address);
+                if (!serverAddressOpt) {
+                    std::cerr << "Failed to resolve address: " << address << std::endl;
+                    delete gameClient;
+                    gameClient = nullptr;
+                    return false;
+                }
+
+                if (!networkManager.joinGame(*serverAddressOpt, port)) {
+                    std::cerr << "Failed to connect to server" << std::endl;
+                    delete gameClient;
+                    gameClient = nullptr;
+                    return false;
+                }
+
+                // Set up callback for game state processing
+                networkManager.onGameStateReceived = [this](const GameState& state) {
+                    if (gameClient) {
+                        try {
+                            gameClient->processGameState(state);
+                        }
+                        catch (const std::exception& e) {
+                            std::cerr << "Exception processing game state: " << e.what() << std::endl;
+                        }
+                    }
+                    };
+
+                networkManager.setGameClient(gameClient);
+                std::cout << "Successfully connected to server!" << std::endl;
+                std::cout << "Network connection established." << std::endl;
+            }
+            catch (const std::exception& e) {
+                std::cerr << "Exception creating GameClient: " << e.what() << std::endl;
+                delete gameClient;
+                gameClient = nullptr;
+                return false;
+            }
+        }
+
+        return true;
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Exception in initialize: " << e.what() << std::endl;
+        // Clean up any partially initialized resources
+        delete gameServer;
+        gameServer = nullptr;
+        delete gameClient;
+        gameClient = nullptr;
+        return false;
+    }
+    catch (...) {
+        std::cerr << "Unknown exception in initialize" << std::endl;
+        // Clean up any partially initialized resources
+        delete gameServer;
+        gameServer = nullptr;
+        delete gameClient;
+        gameClient = nullptr;
+        return false;
+    }
+}
+
+
+void NetworkWrapper::pollNetwork()
+{
+    try {
+        // Update network manager
+        networkManager.update();
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Exception in NetworkWrapper::pollNetwork: " << e.what() << std::endl;
+    }
+    catch (...) {
+        std::cerr << "Unknown exception in NetworkWrapper::pollNetwork" << std::endl;
+    }
+}
+
+void NetworkWrapper::publishState()
+{
+    try {
+        // Send game state to clients at the snapshot rate, not once per frame
+        if (isHost && gameServer && snapshotAccumulator >= snapshotInterval) {
+            // After a hitch send one state, not a burst of stale ones
+            snapshotAccumulator = std::fmod(snapshotAccumulator, snapshotInterval);
+            networkManager.sendClientGameStates();
+        }
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Exception in NetworkWrapper::publishState: " << e.what() << std::endl;
+    }
+    catch (...) {
+        std::cerr << "Unknown exception in NetworkWrapper::publishState" << std::endl;
+    }
+}
+
+void NetworkWrapper::setSnapshotRate(float rate)
+{
+    if (rate > 0.0f) {
+        snapshotInterval = 1.0f / rate;
+    }
+}
+
+void NetworkWrapper::step(float deltaTime)
+{
+    try {
+        // Update game components based on connection state
+        if (isHost && gameServer) {
+            gameServer->update(deltaTime);
+            snapshotAccumulator += deltaTime;
+        }
+        else if (!isHost && gameClient) {
+            // Check if we've received a player ID yet
+            if (gameClient->getLocalPlayerId() > 0) {
+                // We have an ID, check if we're fully connected
+                if (gameClient->isConnected()) {
+                    // Fully connected, update normally
+                    gameClient->update(deltaTime);
+                }
+                else if (gameClient->isWaitingForState()) {
+                    // Waiting for initial state, don't update yet
+                    // but could add a timeout check here
+                    std::cout << "Waiting for initial game state..." << std::endl;
+                }
+            }
+            else {
+                // Still waiting for player ID
+                std::cout << "Waiting for player ID from server..." << std::endl;
+            }
+        }
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Exception in NetworkWrapper::step: " << e.what() << std::endl;
+    }
+    catch (...) {
+        std::cerr << "Unknown exception in NetworkWrapper::step" << std::endl;
+    }
+}
@@ -1,31 +1,46 @@
-// NetworkWrapper.h
-#pragma once
-#include "NetworkManager.h"
-#include "GameServer.h"
-#include "GameClient.h"
-
-class NetworkWrapper {
-private:
-    NetworkManager networkManager;
-    GameServer* gameServer;
-    GameClient* gameClient;
-    bool isMultiplayer;
-    bool isHost;
-
-public:
-    NetworkWrapper();
-    ~NetworkWrapper();
-
-    bool initialize(bool host, const std::string& address = "", unsigned short port = 5000);
-    void update(float deltaTime);
-
-    // Getters
-    bool isConnected() const { return networkManager.isConnected(); }
-    int getPing() const { return networkManager.getPing(); }
-    int getPacketLoss() const { return networkManager.getPacketLoss(); }
-
-    // Access to components
-    GameServer* getServer() { return gameServer; }
-    GameClient* getClient() { return gameClient; }
-    NetworkManager* getNetworkManager() { return &networkManager; }
+// NetworkWrapper.h
+#pragma once
+#include "NetworkManager.h"
+#include "GameServer.h"
+#include "GameClient.h"
+
+class NetworkWrapper {
+private:
+    NetworkManager networkManager;
+    GameServer* gameServer;
+    GameClient* gameClient;
+    bool isMultiplayer;
+    bool isHost;
+
+    // Broadcast cadence - simulated time since the last state went out
+    float snapshotInterval;
+    float snapshotAccumulator;
+
+public:
+    NetworkWrapper();
+    ~NetworkWrapper();
+
+    bool initialize(bool host, const std::string& address = "", unsigned short port = 5000);
+
+    // Called once per frame - receives and dispatches pending network messages
+    void pollNetwork();
+    // Called once per fixed physics step - advances the server or client simulation
+    void step(float deltaTime);
+    // Called once per frame after stepping - host sends its latest state to clients
+    // whenever a snapshot interval of simulated time has passed
+    void publishState();
+
+    // States per second sent to each client; the physics tick rate is separate
+    void setSnapshotRate(float rate);
+    float getSnapshotRate() const { return 1.0f / snapshotInterval; }
+
+    // Getters
+    bool isConnected() const { return networkManager.isConnected(); }
+    int getPing() const { return networkManager.getPing(); }
+    int getPacketLoss() const { return networkManager.getPacketLoss(); }
+
+    // Access to components
+    GameServer* getServer() { return gameServer; }
+    GameClient* getClient() { return gameClient; }
+    NetworkManager* getNetworkManager() { return &networkManager; }
 };
\ No newline at end of file
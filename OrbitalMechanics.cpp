@@ -1,93 +1,198 @@
-// OrbitalMechanics.cpp
-#include "OrbitalMechanics.h"
-#include <cmath>
-
-namespace OrbitalMechanics {
-
-    float calculateApoapsis(sf::Vector2f pos, sf::Vector2f vel, float planetMass, float G) {
-        // Calculate specific orbital energy
-        float speed = std::sqrt(vel.x * vel.x + vel.y * vel.y);
-        float distance = std::sqrt(pos.x * pos.x + pos.y * pos.y);
-        float energy = 0.5f * speed * speed - G * planetMass / distance;
-
-        // Calculate semi-major axis
-        float semiMajor = -G * planetMass / (2 * energy);
-
-        // If energy is positive, orbit is hyperbolic (no apoapsis)
-        if (energy >= 0) return -1.0f;
-
-        // Calculate eccentricity vector
-        sf::Vector2f eVec;
-        float vSquared = speed * speed;
-        eVec.x = (vSquared * pos.x - (pos.x * vel.x + pos.y * vel.y) * vel.x) / (G * planetMass) - pos.x / distance;
-        eVec.y = (vSquared * pos.y - (pos.x * vel.x + pos.y * vel.y) * vel.y) / (G * planetMass) - pos.y / distance;
-        float ecc = std::sqrt(eVec.x * eVec.x + eVec.y * eVec.y);
-
-        // Calculate apoapsis
-        return semiMajor * (1 + ecc);
-    }
-
-    float calculatePeriapsis(sf::Vector2f pos, sf::Vector2f vel, float planetMass, float G) {
-        // Calculate specific orbital energy
-        float speed = std::sqrt(vel.x * vel.x + vel.y * vel.y);
-        float distance = std::sqrt(pos.x * pos.x + pos.y * pos.y);
-        float energy = 0.5f * speed * speed - G * planetMass / distance;
-
-        // Calculate semi-major axis
-        float semiMajor = -G * planetMass / (2 * energy);
-
-        // If energy is positive, orbit is hyperbolic
-        if (energy >= 0) return -1.0f;
-
-        // Calculate eccentricity vector
-        sf::Vector2f eVec;
-        float vSquared = speed * speed;
-        eVec.x = (vSquared * pos.x - (pos.x * vel.x + pos.y * vel.y) * vel.x) / (G * planetMass) - pos.x / distance;
-        eVec.y = (vSquared * pos.y - (pos.x * vel.x + pos.y * vel.y) * vel.y) / (G * planetMass) - pos.y / distance;
-        float ecc = std::sqrt(eVec.x * eVec.x + eVec.y * eVec.y);
-
-        // Calculate periapsis
-        return semiMajor * (1 - ecc);
-    }
-
-    float calculateOrbitalPeriod(float semimajorAxis, float planetMass, float G) {
-        // Kepler's Third Law: T^2 ? a^3
-        // T = 2??(a^3/?) where ? = GM
-        if (semimajorAxis <= 0) return -1.0f; // Not a closed orbit
-
-        return 2.0f * 3.14159f * std::sqrt(std::pow(semimajorAxis, 3) / (G * planetMass));
-    }
-
-    float calculateSemimajorAxis(float energy, float planetMass, float G) {
-        // a = -?/(2E) where ? = GM
-        if (energy >= 0) return -1.0f; // Not a closed orbit
-
-        return -G * planetMass / (2.0f * energy);
-    }
-
-    sf::Vector2f calculateEccentricityVector(sf::Vector2f pos, sf::Vector2f vel, float planetMass, float G) {
-        float speed = std::sqrt(vel.x * vel.x + vel.y * vel.y);
-        float distance = std::sqrt(pos.x * pos.x + pos.y * pos.y);
-        float vSquared = speed * speed;
-
-        sf::Vector2f eVec;
-        eVec.x = (vSquared * pos.x - (pos.x * vel.x + pos.y * vel.y) * vel.x) / (G * planetMass) - pos.x / distance;
-        eVec.y = (vSquared * pos.y - (pos.x * vel.x + pos.y * vel.y) * vel.y) / (G * planetMass) - pos.y / distance;
-
-        return eVec;
-    }
-
-    float calculateEccentricity(sf::Vector2f pos, sf::Vector2f vel, float planetMass, float G) {
-        sf::Vector2f eVec = calculateEccentricityVector(pos, vel, planetMass, G);
-        return std::sqrt(eVec.x * eVec.x + eVec.y * eVec.y);
-    }
-
-    float calculateOrbitalEnergy(sf::Vector2f pos, sf::Vector2f vel, float planetMass, float G) {
-        float speed = std::sqrt(vel.x * vel.x + vel.y * vel.y);
-        float distance = std::sqrt(pos.x * pos.x + pos.y * pos.y);
-
-        // E = v/2 - ?/r
-        return 0.5f * speed * speed - G * planetMass / distance;
-    }
-
+// OrbitalMechanics.cpp
+#include "OrbitalMechanics.h"
+#include <cmath>
+
+namespace OrbitalMechanics {
+
+    float calculateApoapsis(sf::Vector2f pos, sf::Vector2f vel, float planetMass, float G) {
+        // Calculate specific orbital energy
+        float speed = std::sqrt(vel.x * vel.x + vel.y * vel.y);
+        float distance = std::sqrt(pos.x * pos.x + pos.y * pos.y);
+        float energy = 0.5f * speed * speed - G * planetMass / distance;
+
+        // Calculate semi-major axis
+        float semiMajor = -G * planetMass / (2 * energy);
+
+        // If energy is positive, orbit is hyperbolic (no apoapsis)
+        if (energy >= 0) return -1.0f;
+
+        // Calculate eccentricity vector
+        sf::Vector2f eVec;
+        float vSquared = speed * speed;
+        eVec.x = (vSquared * pos.x - (pos.x * vel.x + pos.y * vel.y) * vel.x) / (G * planetMass) - pos.x / distance;
+        eVec.y = (vSquared * pos.y - (pos.x * vel.x + pos.y * vel.y) * vel.y) / (G * planetMass) - pos.y / distance;
+        float ecc = std::sqrt(eVec.x * eVec.x + eVec.y * eVec.y);
+
+        // Calculate apoapsis
+        return semiMajor * (1 + ecc);
+    }
+
+    float calculatePeriapsis(sf::Vector2f pos, sf::Vector2f vel, float planetMass, float G) {
+        // Calculate specific orbital energy
+        float speed = std::sqrt(vel.x * vel.x + vel.y * vel.y);
+        float distance = std::sqrt(pos.x * pos.x + pos.y * pos.y);
+        float energy = 0.5f * speed * speed - G * planetMass / distance;
+
+        // Calculate semi-major axis
+        float semiMajor = -G * planetMass / (2 * energy);
+
+        // If energy is positive, orbit is hyperbolic
+        if (energy >= 0) return -1.0f;
+
+        // Calculate eccentricity vector
+        sf::Vector2f eVec;
+        float vSquared = speed * speed;
+        eVec.x = (vSquared * pos.x - (pos.x * vel.x + pos.y * vel.y) * vel.x) / (G * planetMass) - pos.x / distance;
+        eVec.y = (vSquared * pos.y - (pos.x * vel.x + pos.y * vel.y) * vel.y) / (G * planetMass) - pos.y / distance;
+        float ecc = std::sqrt(eVec.x * eVec.x + eVec.y * eVec.y);
+
+        // Calculate periapsis
+        return semiMajor * (1 - ecc);
+    }
+
+    float calculateOrbitalPeriod(float semimajorAxis, float planetMass, float G) {
+        // Kepler's Third Law: T^2 ? a^3
+        // T = 2??(a^3/?) where ? = GM
+        if (semimajorAxis <= 0) return -1.0f; // Not a closed orbit
+
+        return 2.0f * 3.14159f * std::sqrt(std::pow(semimajorAxis, 3) / (G * planetMass));
+    }
+
+    float calculateSemimajorAxis(float energy, float planetMass, float G) {
+        // a = -?/(2E) where ? = GM
+        if (energy >= 0) return -1.0f; // Not a closed orbit
+
+        return -G * planetMass / (2.0f * energy);
+    }
+
+    sf::Vector2f calculateEccentricityVector(sf::Vector2f pos, sf::Vector2f vel, float planetMass, float G) {
+        float speed = std::sqrt(vel.x * vel.x + vel.y * vel.y);
+        float distance = std::sqrt(pos.x * pos.x + pos.y * pos.y);
+        float vSquared = speed * speed;
+
+        sf::Vector2f eVec;
+        eVec.x = (vSquared * pos.x - (pos.x * vel.x + pos.y * vel.y) * vel.x) / (G * planetMass) - pos.x / distance;
+        eVec.y = (vSquared * pos.y - (pos.x * vel.x + pos.y * vel.y) * vel.y) / (G * planetMass) - pos.y / distance;
+
+        return eVec;
+    }
+
+    float calculateEccentricity(sf::Vector2f pos, sf::Vector2f vel, float planetMass, float G) {
+        sf::Vector2f eVec = calculateEccentricityVector(pos, vel, planetMass, G);
+        return std::sqrt(eVec.x * eVec.x + eVec.y * eVec.y);
+    }
+
+    float calculateOrbitalEnergy(sf::Vector2f pos, sf::Vector2f vel, float planetMass, float G) {
+        float speed = std::sqrt(vel.x * vel.x + vel.y * vel.y);
+        float distance = std::sqrt(pos.x * pos.x + pos.y * pos.y);
+
+        // E = v/2 - ?/r
+        return 0.5f * speed * speed - G * planetMass / distance;
+    }
+
+    OrbitalElements computeElements(sf::Vector2f pos, sf::Vector2f vel, float planetMass, float G) {
+        OrbitalElements a;
+        const float mu = G * planetMass;
+        const float vSquared = vel.x * vel.x + vel.y * vel.y;
+        const float distance = std::sqrt(pos.x * pos.x + pos.y * pos.y);
+        const float rDotV = pos.x * vel.x + pos.y * vel.y;
+
+        a.c = 0.5f * vSquared - mu / distance;
+        a.h = pos.x * vel.y - pos.y * vel.x;
+        a.i = a.c < 0.0f;
+
+        a.a.x = ((vSquared - mu / distance) * pos.x - rDotV * vel.x) / mu;
+        a.a.y = ((vSquared - mu / distance) * pos.y - rDotV * vel.y) / mu;
+        a.b = std::sqrt(a.a.x * a.a.x + a.a.y * a.a.y);
+
+        a.d = -mu / (2.0f * a.c);
+
+        // r_p = p / (1 + e) with p = h^2 / mu also covers hyperbolas
+        a.e = (a.h * a.h / mu) / (1.0f + a.b);
+
+        if (a.i) {
+            a.f = a.d * (1.0f + a.b);
+            a.g = 2.0f * 3.14159f * a.d * std::sqrt(a.d / mu);
+        }
+        else {
+            a.f = -1.0f;
+            a.g = -1.0f;
+        }
+        return a;
+    }
+
+    bool calculateConic(sf::Vector2f pos, sf::Vector2f vel, float planetMass, float G, Conic& conic) {
+        const double mu = static_cast<double>(G) * planetMass;
+        const double rx = pos.x, ry = pos.y;
+        const double vx = vel.x, vy = vel.y;
+        const double distance = std::sqrt(rx * rx + ry * ry);
+        if (mu <= 0.0 || distance <= 0.0) return false;
+
+        // Specific angular momentum (z component)
+        const double h = rx * vy - ry * vx;
+        const double speed = std::sqrt(vx * vx + vy * vy);
+        if (std::abs(h) < 1e-6 * distance * speed) return false; // radial
+
+        const double vSquared = vx * vx + vy * vy;
+        const double rDotV = rx * vx + ry * vy;
+        const double ex = ((vSquared - mu / distance) * rx - rDotV * vx) / mu;
+        const double ey = ((vSquared - mu / distance) * ry - rDotV * vy) / mu;
+        const double ecc = std::sqrt(ex * ex + ey * ey);
+        if (std::abs(ecc - 1.0) < 1e-4) return false; // parabolic
+
+        conic.a = ecc;
+        conic.b = h * h / mu;
+        conic.d = h >= 0.0 ? 1.0 : -1.0;
+        // A circle has no periapsis - measure anomalies from the x axis instead
+        conic.c = ecc > 1e-9 ? std::atan2(ey, ex) : 0.0;
+        conic.g = mu;
+
+        const double semiMajor = conic.b / (1.0 - ecc * ecc);
+        conic.e = std::sqrt(mu / std::abs(semiMajor * semiMajor * semiMajor));
+
+        conic.f = conic.d * (std::atan2(ry, rx) - conic.c);
+        conic.f = std::remainder(conic.f, 2.0 * 3.14159265358979323846);
+        return true;
+    }
+
+    double calculateConicRadius(const Conic& conic, double nu) {
+        return conic.b / (1.0 + conic.a * std::cos(nu));
+    }
+
+    void calculateConicState(const Conic& conic, double nu, sf::Vector2f& pos, sf::Vector2f& vel) {
+        const double distance = calculateConicRadius(conic, nu);
+        const double speedScale = std::sqrt(conic.g / conic.b);
+
+        // Perifocal frame, mirrored for clockwise orbits, then rotated to world space
+        const double px = distance * std::cos(nu);
+        const double py = conic.d * distance * std::sin(nu);
+        const double qx = -speedScale * std::sin(nu);
+        const double qy = conic.d * speedScale * (conic.a + std::cos(nu));
+
+        const double cosW = std::cos(conic.c);
+        const double sinW = std::sin(conic.c);
+        pos = sf::Vector2f(static_cast<float>(px * cosW - py * sinW), static_cast<float>(px * sinW + py * cosW));
+        vel = sf::Vector2f(static_cast<float>(qx * cosW - qy * sinW), static_cast<float>(qx * sinW + qy * cosW));
+    }
+
+    double calculateConicTime(const Conic& conic, double nu) {
+        const double twoPi = 2.0 * 3.14159265358979323846;
+        const double e = conic.a;
+
+        if (e < 1.0) {
+            // Whole revolutions add one period each
+            double revolutions = std::floor((nu + twoPi * 0.5) / twoPi);
+            double wrapped = nu - revolutions * twoPi;
+
+            double eccentricAnomaly = 2.0 * std::atan(std::sqrt((1.0 - e) / (1.0 + e)) * std::tan(wrapped * 0.5));
+            double meanAnomaly = eccentricAnomaly - e * std::sin(eccentricAnomaly);
+            return (meanAnomaly + revolutions * twoPi) / conic.e;
+        }
+
+        // Hyperbola - nu stays inside the asymptotes
+        double hyperbolicAnomaly = 2.0 * std::atanh(std::sqrt((e - 1.0) / (e + 1.0)) * std::tan(nu * 0.5));
+        double meanAnomaly = e * std::sinh(hyperbolicAnomaly) - hyperbolicAnomaly;
+        return meanAnomaly / conic.e;
+    }
+
 } // namespace OrbitalMechanics
\ No newline at end of file
@@ -1,26 +1,69 @@
-// OrbitalMechanics.h
-#pragma once
-#include <SFML/System/Vector2.hpp>
-
-namespace OrbitalMechanics {
-    // Calculate apoapsis (furthest point in orbit) from relative position and velocity
-    float calculateApoapsis(sf::Vector2f pos, sf::Vector2f vel, float planetMass, float G);
-
-    // Calculate periapsis (closest point in orbit) from relative position and velocity
-    float calculatePeriapsis(sf::Vector2f pos, sf::Vector2f vel, float planetMass, float G);
-
-    // Calculate orbital period in seconds
-    float calculateOrbitalPeriod(float semimajorAxis, float planetMass, float G);
-
-    // Calculate semi-major axis from specific orbital energy
-    float calculateSemimajorAxis(float energy, float planetMass, float G);
-
-    // Calculate eccentricity vector
-    sf::Vector2f calculateEccentricityVector(sf::Vector2f pos, sf::Vector2f vel, float planetMass, float G);
-
-    // Calculate eccentricity (scalar)
-    float calculateEccentricity(sf::Vector2f pos, sf::Vector2f vel, float planetMass, float G);
-
-    // Calculate specific orbital energy
-    float calculateOrbitalEnergy(sf::Vector2f pos, sf::Vector2f vel, float planetMass, float G);
+// OrbitalMechanics.h
+#pragma once
+#include <SFML/System/Vector2.hpp>
+#include <cstddef>
+
+namespace OrbitalMechanics {
+    // Calculate apoapsis (furthest point in orbit) from relative position and velocity
+    float calculateApoapsis(sf::Vector2f pos, sf::Vector2f vel, float planetMass, float G);
+
+    // Calculate periapsis (closest point in orbit) from relative position and velocity
+    float calculatePeriapsis(sf::Vector2f pos, sf::Vector2f vel, float planetMass, float G);
+
+    // Calculate orbital period in seconds
+    float calculateOrbitalPeriod(float semimajorAxis, float planetMass, float G);
+
+    // Calculate semi-major axis from specific orbital energy
+    float calculateSemimajorAxis(float energy, float planetMass, float G);
+
+    // Calculate eccentricity vector
+    sf::Vector2f calculateEccentricityVector(sf::Vector2f pos, sf::Vector2f vel, float planetMass, float G);
+
+    // Calculate eccentricity (scalar)
+    float calculateEccentricity(sf::Vector2f pos, sf::Vector2f vel, float planetMass, float G);
+
+    // Calculate specific orbital energy
+    float calculateOrbitalEnergy(sf::Vector2f pos, sf::Vector2f vel, float planetMass, float G);
+
+    // Every element of a two-body orbit, computed together so speed, distance,
+    // energy and the eccentricity vector are only worked out once
+    struct OrbitalElements {
+        sf::Vector2f a; // eccentricityVector
+        float b; // eccentricity
+        float c; // energy - specific orbital energy
+        float d; // semiMajorAxis - negative for hyperbolic orbits
+        float e; // periapsis - closest approach, valid for every conic
+        float f; // apoapsis - -1 when the orbit is not closed
+        float g; // period - -1 when the orbit is not closed
+        float h; // angularMomentum - specific, positive counter-clockwise
+        bool i; // bound - energy < 0
+    };
+
+    // All elements from relative position and velocity in one pass
+    OrbitalElements computeElements(sf::Vector2f pos, sf::Vector2f vel, float planetMass, float G);
+
+    // Closed-form two-body orbit (ellipse or hyperbola) around a planet, parameterised
+    // by true anomaly. Anomalies keep counting past 2*pi so times stay monotonic.
+    struct Conic {
+        double a; // eccentricity
+        double b; // semiLatusRectum - p = h^2 / mu
+        double c; // argumentOfPeriapsis - direction of the eccentricity vector
+        double d; // direction - +1 counter-clockwise, -1 clockwise
+        double e; // meanMotion - rad/s, for hyperbolas the hyperbolic mean motion
+        double f; // trueAnomaly - of the state the conic was built from
+        double g; // mu - G * planetMass
+    };
+
+    // Builds the conic through relative pos/vel. Returns false for (near) radial or
+    // parabolic motion, which the closed form does not handle well.
+    bool calculateConic(sf::Vector2f pos, sf::Vector2f vel, float planetMass, float G, Conic& conic);
+
+    // Relative position and velocity at true anomaly nu
+    void calculateConicState(const Conic& conic, double nu, sf::Vector2f& pos, sf::Vector2f& vel);
+
+    // Distance from the planet at true anomaly nu
+    double calculateConicRadius(const Conic& conic, double nu);
+
+    // Time from periapsis to true anomaly nu (negative before periapsis)
+    double calculateConicTime(const Conic& conic, double nu);
 }
\ No newline at end of file
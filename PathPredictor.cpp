@@ -0,0 +1,429 @@
+// PathPredictor.cpp
+#include "PathPredictor.h"
+#include "GameConstants.h"
+#include "OrbitalMechanics.h"
+#include <cmath>
+#include <algorithm>
+#include <iostream>
+#include <limits>
+
+namespace {
+    // How many steps run between checks for a newer request
+    constexpr int CANCEL_CHECK_INTERVAL = 16;
+
+    // Share of the tolerance the local integration error of one step may use.
+    // The rest is left for error that builds up over the whole path.
+    constexpr double STEP_ERROR_FRACTION = 0.1;
+
+    // Rejected step sizes tried before a step is forced through at the minimum
+    constexpr int MAX_STEP_ATTEMPTS = 16;
+
+    constexpr double PI = 3.14159265358979323846;
+
+    // Sphere of influence of planet index inside the system dominated by planet heaviest:
+    // r_soi = distance * (m / M)^(2/5). The heaviest planet's own reaches everywhere.
+    double sphereOfInfluence(const PackedBodies& planets, size_t index, size_t heaviest)
+    {
+        if (index == heaviest) return std::numeric_limits<double>::infinity();
+
+        double dx = planets.a[index] - planets.a[heaviest];
+        double dy = planets.b[index] - planets.b[heaviest];
+        return std::sqrt(dx * dx + dy * dy) * std::pow(planets.c[index] / planets.c[heaviest], 0.4);
+    }
+
+    // Dormand-Prince 5(4) tableau. Row 6 is also the 5th order solution.
+    constexpr double DP_A[7][6] = {
+        { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 },
+        { 1.0 / 5.0, 0.0, 0.0, 0.0, 0.0, 0.0 },
+        { 3.0 / 40.0, 9.0 / 40.0, 0.0, 0.0, 0.0, 0.0 },
+        { 44.0 / 45.0, -56.0 / 15.0, 32.0 / 9.0, 0.0, 0.0, 0.0 },
+        { 19372.0 / 6561.0, -25360.0 / 2187.0, 64448.0 / 6561.0, -212.0 / 729.0, 0.0, 0.0 },
+        { 9017.0 / 3168.0, -355.0 / 33.0, 46732.0 / 5247.0, 49.0 / 176.0, -5103.0 / 18656.0, 0.0 },
+        { 35.0 / 384.0, 0.0, 500.0 / 1113.0, 125.0 / 192.0, -2187.0 / 6784.0, 11.0 / 84.0 }
+    };
+
+    // Difference between the 5th and 4th order weights - the error estimate
+    constexpr double DP_E[7] = {
+        71.0 / 57600.0, 0.0, -71.0 / 16695.0, 71.0 / 1920.0, -17253.0 / 339200.0, 22.0 / 525.0, -1.0 / 40.0
+    };
+
+    // Gravitational acceleration at (x, y). Returns false if the point is inside a planet.
+    bool accelerationAt(const PackedBodies& planets, double x, double y, double& ax, double& ay)
+    {
+        ax = 0.0;
+        ay = 0.0;
+
+        for (size_t a = 0; a < planets.size(); a++) {
+            double dx = planets.a[a] - x;
+            double dy = planets.b[a] - y;
+            double distSquared = dx * dx + dy * dy;
+            double reach = planets.d[a] + GameConstants::TRAJECTORY_COLLISION_RADIUS;
+
+            if (distSquared <= reach * reach) return false;
+
+            double dist = std::sqrt(distSquared);
+            double k = GameConstants::G * planets.c[a] / (distSquared * dist);
+            ax += dx * k;
+            ay += dy * k;
+        }
+        return true;
+    }
+}
+
+PathPredictor::PathPredictor()
+    : e(false)
+{
+    a = std::thread(&PathPredictor::workerLoop, this);
+}
+
+PathPredictor::~PathPredictor()
+{
+    {
+        std::lock_guard<std::mutex> a(b);
+        e = true;
+    }
+    c.notify_all();
+
+    if (a.joinable()) {
+        a.join();
+    }
+}
+
+PathPredictor& PathPredictor::getInstance()
+{
+    static PathPredictor a;
+    return a;
+}
+
+void PathPredictor::submit(const std::shared_ptr<Job>& job, Request& request)
+{
+    bool a = false; // needs queueing
+
+    {
+        std::lock_guard<std::mutex> b(job->a);
+        std::swap(job->b, request);
+        job->d = true;
+        job->e = false;
+        job->g++;
+        if (!job->f) {
+            job->f = true;
+            a = true;
+        }
+    }
+
+    if (a) {
+        {
+            std::lock_guard<std::mutex> b(this->b);
+            d.push_back(job);
+        }
+        c.notify_one();
+    }
+}
+
+void PathPredictor::cancel(Job& job)
+{
+    std::lock_guard<std::mutex> a(job.a);
+    job.d = false;
+    job.e = false;
+    job.g++;
+}
+
+bool PathPredictor::collect(Job& job, Result& out)
+{
+    std::lock_guard<std::mutex> a(job.a);
+    if (!job.e) return false;
+
+    std::swap(job.c, out);
+    job.e = false;
+    return true;
+}
+
+void PathPredictor::workerLoop()
+{
+    while (true) {
+        std::shared_ptr<Job> a;
+
+        {
+            std::unique_lock<std::mutex> b(this->b);
+            c.wait(b, [this] { return e || !d.empty(); });
+            if (e) return;
+
+            a = d.front();
+            d.pop_front();
+        }
+
+        // Take the job's latest request; anything submitted after this re-queues it
+        unsigned b = 0;
+        {
+            std::lock_guard<std::mutex> c(a->a);
+            a->f = false;
+            if (!a->d) continue;
+            std::swap(f, a->b);
+            a->d = false;
+            b = a->g;
+        }
+
+        try {
+            if (!integrate(*a, b)) continue;
+        }
+        catch (const std::exception& c) {
+            std::cerr << "Exception in PathPredictor::integrate: " << c.what() << std::endl;
+            continue;
+        }
+
+        // Publish unless the owner moved on while we were integrating
+        std::lock_guard<std::mutex> c(a->a);
+        if (a->g == b) {
+            std::swap(a->c, g);
+            a->e = true;
+        }
+    }
+}
+
+bool PathPredictor::advance(const PackedBodies& planets, State& state, float tolerance, float maxStep)
+{
+    const double minStep = maxStep * 1e-4;
+    const double errorLimit = tolerance * STEP_ERROR_FRACTION;
+
+    const double x0 = state.a.x;
+    const double y0 = state.a.y;
+    const double vx0 = state.b.x;
+    const double vy0 = state.b.y;
+
+    double h = std::min(std::max(static_cast<double>(state.d), minStep), static_cast<double>(maxStep));
+
+    for (int attempt = 0; attempt < MAX_STEP_ATTEMPTS; attempt++) {
+        // Stage derivatives: position' = velocity, velocity' = acceleration
+        double kx[7], ky[7], kvx[7], kvy[7];
+        double x = x0, y = y0, vx = vx0, vy = vy0;
+        bool inside = false;
+
+        for (int a = 0; a < 7; a++) {
+            x = x0; y = y0; vx = vx0; vy = vy0;
+            for (int b = 0; b < a; b++) {
+                x += h * DP_A[a][b] * kx[b];
+                y += h * DP_A[a][b] * ky[b];
+                vx += h * DP_A[a][b] * kvx[b];
+                vy += h * DP_A[a][b] * kvy[b];
+            }
+
+            kx[a] = vx;
+            ky[a] = vy;
+            if (!accelerationAt(planets, x, y, kvx[a], kvy[a])) {
+                inside = true;
+                break;
+            }
+        }
+
+        const bool lastChance = h <= minStep || attempt == MAX_STEP_ATTEMPTS - 1;
+
+        if (inside) {
+            // Close in on the surface before reporting the hit
+            if (lastChance) return false;
+            h = std::max(h * 0.25, minStep);
+            continue;
+        }
+
+        // (x, y, vx, vy) now hold the 5th order solution fed to the last stage
+        double ex = 0.0, ey = 0.0, evx = 0.0, evy = 0.0;
+        for (int a = 0; a < 7; a++) {
+            ex += DP_E[a] * kx[a];
+            ey += DP_E[a] * ky[a];
+            evx += DP_E[a] * kvx[a];
+            evy += DP_E[a] * kvy[a];
+        }
+        double error = std::max(h * std::sqrt(ex * ex + ey * ey), h * h * std::sqrt(evx * evx + evy * evy));
+
+        // Segment error: a straight chord of an arc bulges by about a_perp * h^2 / 8
+        double speed = std::sqrt(vx0 * vx0 + vy0 * vy0);
+        double accelPerp = speed > 0.0 ? std::abs(kvx[0] * vy0 - kvy[0] * vx0) / speed : 0.0;
+        double chordStep = accelPerp > 0.0 ? std::sqrt(8.0 * tolerance / accelPerp) : maxStep;
+
+        // Standard controller with safety factor 0.9, changing by at most 5x per step
+        double scale = error > 0.0 ? 0.9 * std::pow(errorLimit / error, 0.2) : 5.0;
+        scale = std::min(std::max(scale, 0.2), 5.0);
+
+        if ((error <= errorLimit && h <= chordStep * 1.01) || lastChance) {
+            state.a = sf::Vector2f(static_cast<float>(x), static_cast<float>(y));
+            state.b = sf::Vector2f(static_cast<float>(vx), static_cast<float>(vy));
+            state.c += static_cast<float>(h);
+            state.d = static_cast<float>(std::max(minStep, std::min({ h * scale, chordStep, static_cast<double>(maxStep) })));
+            return true;
+        }
+
+        h = std::max(minStep, std::min(h * std::min(scale, 1.0), chordStep));
+    }
+
+    return true;
+}
+
+bool PathPredictor::integrate(Job& job, unsigned generation)
+{
+    const float horizon = f.d * static_cast<float>(f.e);
+    const float maxStep = f.d * GameConstants::TRAJECTORY_MAX_STEP_SCALE;
+
+    State a;
+    a.a = f.b;
+    a.b = f.c;
+    a.c = 0.0f;
+    a.d = f.d;
+
+    g.a.clear();
+    g.b.clear();
+    g.c.clear();
+    g.d = false;
+    g.e = 0.0f;
+
+    // Deep inside one planet's sphere of influence the path is a conic - only
+    // integrate numerically from wherever the conic leaves it
+    if (predictConic(a, horizon)) {
+        return true;
+    }
+
+    for (int step = static_cast<int>(g.a.size()); step < f.e && a.c < horizon; step++) {
+        if (step % CANCEL_CHECK_INTERVAL == 0 && job.g != generation) {
+            return false;
+        }
+
+        if (!advance(f.a, a, f.f, maxStep)) {
+            g.d = true;
+            break;
+        }
+
+        g.a.push_back(a.a);
+        g.b.push_back(a.b);
+        g.c.push_back(a.c);
+    }
+
+    return true;
+}
+
+bool PathPredictor::predictConic(State& state, float horizon)
+{
+    const PackedBodies& a = f.a;
+    if (a.size() == 0) return false;
+
+    size_t heaviest = 0;
+    for (size_t b = 1; b < a.size(); b++) {
+        if (a.c[b] > a.c[heaviest]) heaviest = b;
+    }
+    if (a.c[heaviest] <= 0.0f) return false;
+
+    // Dominant body - the smallest sphere of influence the body is inside
+    size_t dominant = heaviest;
+    double soi = std::numeric_limits<double>::infinity();
+    for (size_t b = 0; b < a.size(); b++) {
+        double c = sphereOfInfluence(a, b, heaviest);
+        double dx = state.a.x - a.a[b];
+        double dy = state.a.y - a.b[b];
+        if (c < soi && dx * dx + dy * dy < c * c) {
+            dominant = b;
+            soi = c;
+        }
+    }
+
+    sf::Vector2f center(a.a[dominant], a.b[dominant]);
+    sf::Vector2f relPos = state.a - center;
+    double distance = std::sqrt(relPos.x * relPos.x + relPos.y * relPos.y);
+    if (distance > soi * GameConstants::KEPLER_SOI_FRACTION) return false;
+
+    // Only when the other planets are a small perturbation here
+    double ax = 0.0, ay = 0.0;
+    for (size_t b = 0; b < a.size(); b++) {
+        if (b == dominant) continue;
+        double dx = a.a[b] - state.a.x;
+        double dy = a.b[b] - state.a.y;
+        double distSquared = dx * dx + dy * dy;
+        double k = GameConstants::G * a.c[b] / (distSquared * std::sqrt(distSquared));
+        ax += dx * k;
+        ay += dy * k;
+    }
+    double mainAccel = GameConstants::G * a.c[dominant] / (distance * distance);
+    if (std::sqrt(ax * ax + ay * ay) > mainAccel * GameConstants::KEPLER_MAX_PERTURBATION) return false;
+
+    OrbitalMechanics::Conic conic;
+    if (!OrbitalMechanics::calculateConic(relPos, state.b, a.c[dominant], GameConstants::G, conic)) return false;
+
+    const double hitRadius = a.d[dominant] + GameConstants::TRAJECTORY_COLLISION_RADIUS;
+    if (distance <= hitRadius) return false;
+
+    // Where the conic stops: one full revolution for an ellipse, just short of
+    // the asymptote for a hyperbola, or the surface if periapsis is below it
+    const double nuStart = conic.f;
+    double nuEnd = conic.a < 1.0 ? nuStart + 2.0 * PI : std::acos(-1.0 / conic.a) * 0.999;
+    bool hits = false;
+
+    // Outbound this close to the asymptote, the sampling would run backwards -
+    // leave it to numeric integration
+    if (nuEnd <= nuStart) return false;
+
+    double periapsis = conic.b / (1.0 + conic.a);
+    if (periapsis <= hitRadius && conic.a > 1e-9) {
+        // Impact happens on the way in, at -nuHit (plus whole revolutions)
+        double nuHit = -std::acos(std::min(1.0, std::max(-1.0, (conic.b / hitRadius - 1.0) / conic.a)));
+        while (nuHit < nuStart) nuHit += 2.0 * PI;
+        if (nuHit < nuEnd) {
+            nuEnd = nuHit;
+            hits = true;
+        }
+    }
+
+    const double tStart = OrbitalMechanics::calculateConicTime(conic, nuStart) - state.c;
+    const double tolerance = f.f;
+    double nu = nuStart;
+
+    while (static_cast<int>(g.a.size()) < f.e) {
+        // Angular step that keeps the chord within tolerance - the conic never
+        // curves tighter than the semi-latus rectum
+        double r = OrbitalMechanics::calculateConicRadius(conic, nu);
+        double step = std::sqrt(8.0 * tolerance * conic.b) / r;
+        step = std::min(std::max(step, 1e-4), 0.1);
+
+        double nuNext = std::min(nu + step, nuEnd);
+        double time = OrbitalMechanics::calculateConicTime(conic, nuNext) - tStart;
+        if (time > horizon) return true;
+
+        sf::Vector2f pos, vel;
+        OrbitalMechanics::calculateConicState(conic, nuNext, pos, vel);
+        pos += center;
+
+        state.a = pos;
+        state.b = vel;
+        state.d = f.d;
+        float lastTime = static_cast<float>(time);
+
+        if (nuNext >= nuEnd && hits) {
+            g.d = true;
+            return true;
+        }
+
+        g.a.push_back(pos);
+        g.b.push_back(vel);
+        g.c.push_back(lastTime);
+        state.c = lastTime;
+
+        // Left the sphere of influence, or entered another one - patch over
+        // to numeric integration from here
+        double rNext = OrbitalMechanics::calculateConicRadius(conic, nuNext);
+        if (rNext > soi) return false;
+        for (size_t b = 0; b < a.size(); b++) {
+            if (b == dominant || b == heaviest) continue;
+            double c = sphereOfInfluence(a, b, heaviest);
+            double dx = pos.x - a.a[b];
+            double dy = pos.y - a.b[b];
+            if (dx * dx + dy * dy < c * c) return false;
+        }
+
+        nu = nuNext;
+        if (nu >= nuEnd) {
+            if (conic.a < 1.0) {
+                // Closed orbit inside the horizon - the cache recycles it
+                g.e = static_cast<float>(2.0 * PI / conic.e);
+                return true;
+            }
+            return false;
+        }
+    }
+
+    return true;
+}
\ No newline at end of file
@@ -0,0 +1,95 @@
+// PathPredictor.h
+#pragma once
+#include <SFML/System/Vector2.hpp>
+#include "GravityKernel.h"
+#include <vector>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <atomic>
+
+// Background thread that integrates predicted paths (rocket trajectories and
+// planet orbits) against a snapshot of the planets, so the render thread only
+// ever draws the latest finished result.
+// Each predicted body owns a Job. Submitting a new request to a Job cancels
+// the one still running for it, and results are handed over by swapping
+// buffers, so no path storage is reallocated once the buffers have grown.
+class PathPredictor {
+public:
+    struct Request {
+        PackedBodies a; // planets - snapshot taken when the request was made
+        sf::Vector2f b; // startPosition
+        sf::Vector2f c; // startVelocity
+        float d; // timeStep - nominal step; the horizon is timeStep * steps
+        int e; // steps - also the most points a path may have
+        float f; // tolerance - allowed position error in world units
+    };
+
+    struct Result {
+        std::vector<sf::Vector2f> a; // positions - one per accepted step after the start
+        std::vector<sf::Vector2f> b; // velocities
+        std::vector<float> c; // times - since the start of the prediction
+        bool d; // hitObject - the path ended on a planet
+        float e; // period - closed orbits repeat after this long, 0 otherwise
+    };
+
+    // Integration state for advance()
+    struct State {
+        sf::Vector2f a; // position
+        sf::Vector2f b; // velocity
+        float c; // time
+        float d; // stepSize - next step to try, adapted by every call
+    };
+
+    class Job {
+        friend class PathPredictor;
+
+        std::mutex a; // mutex
+        Request b; // request - latest submitted, waiting for the worker
+        Result c; // result - latest finished, waiting for the owner
+        bool d = false; // hasRequest
+        bool e = false; // hasResult
+        bool f = false; // queued
+        std::atomic<unsigned> g{ 0 }; // generation - bumped by every submit and cancel
+    };
+
+private:
+    std::thread a; // worker
+    std::mutex b; // queueMutex
+    std::condition_variable c; // queueReady
+    std::deque<std::shared_ptr<Job>> d; // queue
+    bool e; // stopping
+    Request f; // workerRequest - the worker's copy of the request it is running
+    Result g; // workerResult - back buffer the worker integrates into
+
+    PathPredictor();
+    void workerLoop();
+    bool integrate(Job& job, unsigned generation);
+    bool predictConic(State& state, float horizon);
+
+public:
+    ~PathPredictor();
+    PathPredictor(const PathPredictor&) = delete;
+    PathPredictor& operator=(const PathPredictor&) = delete;
+
+    static PathPredictor& getInstance();
+
+    // Queues a prediction for job, replacing (and cancelling) any earlier one.
+    // request is swapped into the job - the caller gets an old buffer back to refill.
+    void submit(const std::shared_ptr<Job>& job, Request& request);
+
+    // Drops whatever is queued or running for job
+    void cancel(Job& job);
+
+    // Swaps the newest finished result into out. Returns false if there is none.
+    bool collect(Job& job, Result& out);
+
+    // One accepted Dormand-Prince 5(4) step through the planets' field.
+    // The step shrinks until the local error is below tolerance and until the
+    // straight segment to the new point deviates from the curve by less than
+    // tolerance, so coasting far from planets takes long steps and close
+    // passes take short ones. Returns false (state unchanged) on a planet hit.
+    static bool advance(const PackedBodies& planets, State& state, float tolerance, float maxStep);
+};
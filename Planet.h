@@ -1,35 +1,55 @@
-#pragma once
-#include "GameObject.h"
-#include <vector>
-
-class Planet : public GameObject {
-private:
-    sf::CircleShape a; // shape
-    float b; // mass
-    float c; // radius
-    int d; // ownerId - which player created/owns this planet, -1 for none
-
-public:
-    Planet(sf::Vector2f pos, float radius, float mass, sf::Color color = sf::Color::Blue, int ownerId = -1);
-    void setPosition(const sf::Vector2f& pos) { position = pos; }
-    sf::Color getColor() const { return color; }
-    void update(float deltaTime) override;
-    void draw(sf::RenderWindow& window) override;
-
-    void setNearbyPlanets(const std::vector<Planet*>& planets);
-
-    float getMass() const;
-    float getRadius() const;
-    int getOwnerId() const { return d; }
-    void setOwnerId(int id) { d = id; }
-
-    // Methods for dynamic radius
-    void setMass(float newMass);
-    void updateRadiusFromMass();
-
-    // Draw velocity vector for the planet
-    void drawVelocityVector(sf::RenderWindow& window, float scale = 1.0f);
-
-    // Draw predicted orbit path
-    void drawOrbitPath(sf::RenderWindow& window, const std::vector<Planet*>& planets, float timeStep = 0.5f, int steps = 2000);
+#pragma once
+#include "GameObject.h"
+#ifndef HEADLESS_SERVER
+#include "TrajectoryCache.h"
+#endif
+#include "EntityHandle.h"
+#include <vector>
+
+class Planet : public GameObject {
+    friend class PlanetPool;
+
+private:
+#ifndef HEADLESS_SERVER
+    sf::CircleShape a; // shape - synced with the simulation in draw()
+#endif
+    float b; // mass
+    float c; // radius
+    int d; // ownerId - which player created/owns this planet, -1 for none
+    bool e; // integrated - GravitySimulator already advanced the position this step
+#ifndef HEADLESS_SERVER
+    TrajectoryCache f; // orbitCache - predicted orbit kept between frames
+#endif
+    EntityHandle g; // handle - assigned by PlanetPool, invalid for planets made outside it
+
+public:
+    Planet(sf::Vector2f pos, float radius, float mass, sf::Color color = sf::Color::Blue, int ownerId = -1);
+    void setPosition(const sf::Vector2f& pos) { position = pos; }
+    sf::Color getColor() const { return color; }
+    void update(float deltaTime) override;
+    void markIntegrated() { e = true; }
+    void shiftOrigin(sf::Vector2f offset) override;
+#ifndef HEADLESS_SERVER
+    void draw(sf::RenderWindow& window) override;
+#endif
+
+    void setNearbyPlanets(const std::vector<Planet*>& planets);
+
+    float getMass() const;
+    float getRadius() const;
+    int getOwnerId() const { return d; }
+    EntityHandle getHandle() const { return g; }
+    void setOwnerId(int id) { d = id; }
+
+    // Methods for dynamic radius
+    void setMass(float newMass);
+    void updateRadiusFromMass();
+
+#ifndef HEADLESS_SERVER
+    // Draw velocity vector for the planet
+    void drawVelocityVector(sf::RenderWindow& window, float scale = 1.0f);
+
+    // Draw predicted orbit path
+    void drawOrbitPath(sf::RenderWindow& window, const std::vector<Planet*>& planets, float timeStep = 0.5f, int steps = 2000);
+#endif
 };
\ No newline at end of file
@@ -0,0 +1,105 @@
+// PlanetPool.cpp
+#include "PlanetPool.h"
+#ifndef HEADLESS_SERVER
+#include "PathPredictor.h"
+#endif
+#include <new>
+#include <iostream>
+#include <stdexcept>
+
+PlanetPool::PlanetPool() : b(-1), c(0), d(0)
+{
+}
+
+PlanetPool::~PlanetPool()
+{
+    // Owners normally destroy their planets first - this only catches stragglers
+    for (size_t i = 0; i < c; i++) {
+        Slot& e = slot(static_cast<uint32_t>(i));
+        if (e.d) {
+            reinterpret_cast<Planet*>(e.a)->~Planet();
+            e.d = false;
+        }
+    }
+}
+
+PlanetPool& PlanetPool::getInstance()
+{
+    // Planets cancel their path predictions when destroyed, so the predictor
+    // has to be constructed first to be destroyed after the pool
+#ifndef HEADLESS_SERVER
+    PathPredictor::getInstance();
+#endif
+    static PlanetPool a;
+    return a;
+}
+
+void PlanetPool::grow()
+{
+    a.emplace_back(new Slot[CHUNK_SIZE]);
+
+    // Thread the new slots onto the free list in index order
+    for (size_t i = CHUNK_SIZE; i-- > 0; ) {
+        Slot& e = a.back()[i];
+        e.b = 1;
+        e.c = b;
+        e.d = false;
+        b = static_cast<int>(c + i);
+    }
+    c += CHUNK_SIZE;
+}
+
+Planet* PlanetPool::create(sf::Vector2f pos, float radius, float mass, sf::Color color, int ownerId)
+{
+    if (b == -1) {
+        // Past this, toId() would hand the same id to two live planets
+        if (c + CHUNK_SIZE > static_cast<size_t>(EntityHandle::MAX_INDEX) + 1) {
+            std::cerr << "PlanetPool is full (" << c << " planets)" << std::endl;
+            throw std::runtime_error("PlanetPool is full");
+        }
+        grow();
+    }
+
+    uint32_t e = static_cast<uint32_t>(b);
+    Slot& f = slot(e);
+
+    Planet* g = new (f.a) Planet(pos, radius, mass, color, ownerId);
+    b = f.c;
+    f.c = -1;
+    f.d = true;
+    g->g = EntityHandle(e, f.b);
+    d++;
+    return g;
+}
+
+void PlanetPool::destroy(Planet* planet)
+{
+    if (!planet) return;
+
+    EntityHandle e = planet->getHandle();
+    if (!e.isValid() || e.a >= c || !slot(e.a).d || slot(e.a).b != e.b) {
+        std::cerr << "PlanetPool::destroy called with a planet the pool does not own" << std::endl;
+        return;
+    }
+
+    Slot& f = slot(e.a);
+    planet->~Planet();
+    f.d = false;
+
+    // Skip generation 0 on wrap-around so default handles never resolve
+    f.b = (f.b + 1) & 0xFFFF;
+    if (f.b == 0) f.b = 1;
+
+    f.c = b;
+    b = static_cast<int>(e.a);
+    d--;
+}
+
+Planet* PlanetPool::get(EntityHandle handle) const
+{
+    if (!handle.isValid() || handle.a >= c) return nullptr;
+
+    Slot& e = slot(handle.a);
+    if (!e.d || e.b != handle.b) return nullptr;
+    return reinterpret_cast<Planet*>(e.a);
+}
@@ -0,0 +1,55 @@
+// PlanetPool.h
+#pragma once
+#include "Planet.h"
+#include "EntityHandle.h"
+#include <vector>
+#include <memory>
+#include <cstddef>
+
+// Free-list arena for Planet instances. Planets are constructed in place in
+// fixed-size chunks that are never moved or freed while the pool lives, so
+// creating and destroying planets (dropped mass, merges) reuses memory instead
+// of going back to the heap. Every planet gets a generational handle whose
+// packed id stays the same for the planet's whole life, unlike its index in
+// any planet list. Main thread only.
+class PlanetPool {
+private:
+    struct Slot {
+        alignas(Planet) unsigned char a[sizeof(Planet)]; // storage
+        uint32_t b; // generation - bumped every time the slot is freed
+        int c; // nextFree - next slot on the free list, -1 at the end
+        bool d; // alive
+    };
+
+    static constexpr size_t CHUNK_SIZE = 64;
+
+    std::vector<std::unique_ptr<Slot[]>> a; // chunks
+    int b; // freeHead - -1 when every slot is in use
+    size_t c; // slotCount
+    size_t d; // liveCount
+
+    PlanetPool();
+    Slot& slot(uint32_t index) const { return a[index / CHUNK_SIZE][index % CHUNK_SIZE]; }
+    void grow();
+
+public:
+    ~PlanetPool();
+
+    PlanetPool(const PlanetPool&) = delete;
+    PlanetPool& operator=(const PlanetPool&) = delete;
+
+    static PlanetPool& getInstance();
+
+    // Same arguments as the Planet constructor. Throws std::runtime_error once
+    // every index a network id can carry (EntityHandle::MAX_INDEX) is in use.
+    Planet* create(sf::Vector2f pos, float radius, float mass, sf::Color color = sf::Color::Blue, int ownerId = -1);
+
+    // Destroys a planet made by create(). Its handle stops resolving.
+    void destroy(Planet* planet);
+
+    // nullptr once the planet has been destroyed
+    Planet* get(EntityHandle handle) const;
+
+    size_t getLiveCount() const { return d; }
+    size_t getCapacity() const { return c; }
+};
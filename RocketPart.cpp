@@ -1,7 +1,7 @@
-// RocketPart.cpp
-#include "RocketPart.h"
-
-RocketPart::RocketPart(sf::Vector2f relPos, sf::Color col)
-    : relativePosition(relPos), color(col)
-{
+// RocketPart.cpp
+#include "RocketPart.h"
+
+RocketPart::RocketPart(sf::Vector2f relPos, sf::Color col)
+    : relativePosition(relPos), color(col)
+{
 }
\ No newline at end of file
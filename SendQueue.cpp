@@ -0,0 +1,60 @@
+// SendQueue.cpp
+#include "SendQueue.h"
+#include "GameConstants.h"
+
+SendQueue::SendQueue()
+    : b(0), // queuedBytes
+    c(false) // frontStarted
+{
+}
+
+bool SendQueue::push(const sf::Packet& packet, bool isState)
+{
+    if (isState) {
+        // Newest queued state that has not started can simply be replaced
+        for (size_t i = a.size(); i-- > 0; ) {
+            if (!a[i].b || (i == 0 && c)) continue;
+
+            b = b - a[i].a.getDataSize() + packet.getDataSize();
+            a[i].a = packet;
+            return true;
+        }
+    }
+
+    if (a.size() >= GameConstants::SEND_QUEUE_MAX_PACKETS ||
+        b + packet.getDataSize() > GameConstants::SEND_QUEUE_MAX_BYTES) {
+        return false;
+    }
+
+    a.push_back({ packet, isState });
+    b += packet.getDataSize();
+    return true;
+}
+
+sf::Socket::Status SendQueue::flush(sf::TcpSocket& socket)
+{
+    while (!a.empty()) {
+        sf::Socket::Status status = socket.send(a.front().a);
+
+        if (status == sf::Socket::Status::Partial) {
+            c = true;
+            return status;
+        }
+        if (status != sf::Socket::Status::Done) {
+            return status;
+        }
+
+        b -= a.front().a.getDataSize();
+        a.pop_front();
+        c = false;
+    }
+
+    return sf::Socket::Status::Done;
+}
+
+void SendQueue::clear()
+{
+    a.clear();
+    b = 0;
+    c = false;
+}
@@ -0,0 +1,40 @@
+// SendQueue.h
+#pragma once
+#include <SFML/Network.hpp>
+#include <deque>
+#include <cstddef>
+
+// Reliable messages waiting for one non-blocking TCP socket. A send can take a
+// packet only partly (Partial) or not at all (NotReady); the packet then stays
+// at the front and goes to the socket again on the next flush - SFML resumes a
+// Partial packet where it stopped, so it must be the same packet object.
+//
+// Game states are coalesced: a new state replaces a queued one that has not
+// started going out, so a slow client gets fewer, newer states instead of a
+// growing backlog. Everything else is kept in order.
+class SendQueue {
+private:
+    struct Entry {
+        sf::Packet a; // packet
+        bool b; // isState
+    };
+
+    std::deque<Entry> a; // entries
+    size_t b; // queuedBytes
+    bool c; // frontStarted - the front packet went out partly
+
+public:
+    SendQueue();
+
+    // False if the packet does not fit the queue limits - the peer is not keeping up
+    bool push(const sf::Packet& packet, bool isState);
+
+    // Sends as much as the socket takes: Done once the queue is empty,
+    // Partial/NotReady while the socket is full, Disconnected/Error on failure
+    sf::Socket::Status flush(sf::TcpSocket& socket);
+
+    void clear();
+    bool empty() const { return a.empty(); }
+    size_t size() const { return a.size(); }
+    size_t getQueuedBytes() const { return b; }
+};
@@ -0,0 +1,112 @@
+// ServerMain.cpp
+// Entry point of the dedicated server (MyGameFlyServer). Built with
+// HEADLESS_SERVER, so it links against sfml-system and sfml-network only and
+// never opens a window: it simulates at the physics tick rate and serves
+// clients until it receives SIGINT/SIGTERM.
+#include <SFML/System.hpp>
+#include <SFML/Network.hpp>
+#include "NetworkWrapper.h"
+#include "FixedTimestep.h"
+#include "GameConstants.h"
+#include <algorithm>
+#include <atomic>
+#include <csignal>
+#include <iostream>
+#include <string>
+
+#ifdef _DEBUG
+#pragma comment(lib, "sfml-system-d.lib")
+#pragma comment(lib, "sfml-network-d.lib")
+#else
+#pragma comment(lib, "sfml-system.lib")
+#pragma comment(lib, "sfml-network.lib")
+#endif
+
+namespace {
+    std::atomic<bool> running(true);
+
+    void handleSignal(int) {
+        running = false;
+    }
+
+    // Usage: MyGameFlyServer [--port <port>] [--snapshot-rate <hz>]
+    bool parseServerCommandLine(int argc, char* argv[], unsigned short& port, float& snapshotRate) {
+        for (int i = 1; i < argc; i++) {
+            std::string arg = argv[i];
+            if (arg == "--port" && i + 1 < argc) {
+                port = static_cast<unsigned short>(std::stoi(argv[++i]));
+            }
+            else if (arg == "--snapshot-rate" && i + 1 < argc) {
+                snapshotRate = std::stof(argv[++i]);
+            }
+            else {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    unsigned short port = 5000;
+    float snapshotRate = GameConstants::SNAPSHOT_RATE;
+
+    try {
+        if (!parseServerCommandLine(argc, argv, port, snapshotRate)) {
+            std::cerr << "Usage: " << argv[0] << " [--port <port>] [--snapshot-rate <hz>]" << std::endl;
+            return 1;
+        }
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Invalid argument: " << e.what() << std::endl;
+        return 1;
+    }
+
+    std::signal(SIGINT, handleSignal);
+    std::signal(SIGTERM, handleSignal);
+
+    NetworkWrapper networkWrapper;
+    if (!networkWrapper.initialize(true, "", port)) {
+        std::cerr << "Failed to start dedicated server on port " << port << std::endl;
+        return 1;
+    }
+    networkWrapper.setSnapshotRate(snapshotRate);
+
+    GameServer* gameServer = networkWrapper.getServer();
+    if (!gameServer) {
+        std::cerr << "GameServer is null." << std::endl;
+        return 1;
+    }
+    gameServer->initialize();
+
+    std::cout << "Dedicated server running on port " << port << " at "
+        << GameConstants::PHYSICS_TICK_RATE << " Hz" << std::endl;
+
+    FixedTimestep physicsClock(GameConstants::PHYSICS_TICK_RATE, GameConstants::PHYSICS_MAX_SUBSTEPS);
+    float fixedDeltaTime = physicsClock.getStepSize();
+    sf::Clock clock;
+
+    while (running) {
+        float frameTime = std::min(clock.restart().asSeconds(), GameConstants::MAX_FRAME_TIME);
+        int physicsSteps = physicsClock.advance(frameTime);
+
+        try {
+            networkWrapper.pollNetwork();
+            for (int step = 0; step < physicsSteps; step++) {
+                networkWrapper.step(fixedDeltaTime);
+            }
+            networkWrapper.publishState();
+        }
+        catch (const std::exception& e) {
+            std::cerr << "Exception in server loop: " << e.what() << std::endl;
+        }
+
+        // Nothing to draw - sleep until the next physics step is due
+        float untilNextStep = fixedDeltaTime * (1.0f - physicsClock.getAlpha());
+        sf::sleep(sf::seconds(untilNextStep - clock.getElapsedTime().asSeconds()));
+    }
+
+    std::cout << "Shutting down dedicated server..." << std::endl;
+    return 0;
+}
@@ -0,0 +1,439 @@
+// SnapshotDelta.cpp
+#include "SnapshotDelta.h"
+#include "BitStream.h"
+#include "GameConstants.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+SnapshotHistory::SnapshotHistory() : a(SIZE), b(SIZE, 0), c(0), d(false)
+{
+}
+
+void SnapshotHistory::store(const GameState& state)
+{
+    size_t e = state.a % SIZE;
+    a[e] = state;
+    b[e] = 1;
+}
+
+const GameState* SnapshotHistory::find(unsigned long sequence) const
+{
+    size_t e = sequence % SIZE;
+    if (!b[e] || a[e].a != sequence) return nullptr;
+    return &a[e];
+}
+
+void SnapshotHistory::acknowledge(unsigned long sequence)
+{
+    // Acks can arrive out of order - only ever move forward
+    if (!d || sequence > c) {
+        c = sequence;
+        d = true;
+    }
+}
+
+void SnapshotHistory::clear()
+{
+    std::fill(b.begin(), b.end(), 0);
+    d = false;
+}
+
+namespace SnapshotDelta {
+
+    namespace {
+        // Field bits
+        enum RocketField : uint32_t {
+            ROCKET_POSITION = 1 << 0,
+            ROCKET_VELOCITY = 1 << 1,
+            ROCKET_ROTATION = 1 << 2,
+            ROCKET_ANGULAR_VELOCITY = 1 << 3,
+            ROCKET_THRUST = 1 << 4,
+            ROCKET_MASS = 1 << 5,
+            ROCKET_COLOR = 1 << 6,
+            ROCKET_AUTHORITATIVE = 1 << 7,
+            ROCKET_FIELD_BITS = 8
+        };
+
+        // Radius is not sent - it follows from the mass
+        enum PlanetField : uint32_t {
+            PLANET_POSITION = 1 << 0,
+            PLANET_VELOCITY = 1 << 1,
+            PLANET_MASS = 1 << 2,
+            PLANET_COLOR = 1 << 3,
+            PLANET_OWNER = 1 << 4,
+            PLANET_ALL = 0x1F,
+            PLANET_FIELD_BITS = 5
+        };
+
+        // Quantization. Positions are fixed point with POSITION_SCALE steps per
+        // world unit, split into a SECTOR_SIZE sector (only sent when it changes)
+        // and the offset inside it.
+        constexpr int POSITION_SCALE = 32;
+        constexpr int SECTOR_BITS = 10; // 1024 world units per sector
+        constexpr int OFFSET_BITS = SECTOR_BITS + 5; // log2(POSITION_SCALE) = 5
+        constexpr int SECTOR_INDEX_BITS = 16;
+        constexpr int VELOCITY_SCALE = 32;
+        constexpr int VELOCITY_BITS = 20; // +-16384 units/s
+        constexpr int ANGLE_BITS = 16;
+        constexpr int ANGULAR_VELOCITY_SCALE = 16;
+        constexpr int ANGULAR_VELOCITY_BITS = 16; // +-2048 deg/s
+        constexpr int THRUST_BITS = 16;
+        // Client ids are never reused, so a long-running server outgrows any narrower field
+        constexpr int OWNER_BITS = 32;
+        constexpr int PLAYER_ID_BITS = 32;
+        constexpr int COUNT_BITS = 16; // holds MAX_ENTITIES
+
+        int64_t quantizePosition(float v) { return std::llround(static_cast<double>(v) * POSITION_SCALE); }
+        int32_t sectorOf(int64_t q) { return static_cast<int32_t>(q >> OFFSET_BITS); }
+
+        int32_t quantizeClamped(float v, int scale, int bits) {
+            const int64_t limit = (int64_t(1) << (bits - 1)) - 1;
+            int64_t q = std::llround(static_cast<double>(v) * scale);
+            return static_cast<int32_t>(std::max(-limit, std::min(limit, q)));
+        }
+
+        uint32_t quantizeAngle(float degrees) {
+            double a = std::fmod(static_cast<double>(degrees), 360.0);
+            if (a < 0.0) a += 360.0;
+            return static_cast<uint32_t>(std::llround(a / 360.0 * 65536.0)) & 0xFFFF;
+        }
+
+        uint32_t quantizeThrust(float level) {
+            return static_cast<uint32_t>(std::llround(std::max(0.0f, std::min(1.0f, level)) * 65535.0f));
+        }
+
+        bool samePosition(sf::Vector2f a, sf::Vector2f b) {
+            return quantizePosition(a.x) == quantizePosition(b.x) && quantizePosition(a.y) == quantizePosition(b.y);
+        }
+        bool sameVelocity(sf::Vector2f a, sf::Vector2f b) {
+            return quantizeClamped(a.x, VELOCITY_SCALE, VELOCITY_BITS) == quantizeClamped(b.x, VELOCITY_SCALE, VELOCITY_BITS) &&
+                quantizeClamped(a.y, VELOCITY_SCALE, VELOCITY_BITS) == quantizeClamped(b.y, VELOCITY_SCALE, VELOCITY_BITS);
+        }
+
+        // States list entities in a stable order, so the match is nearly always
+        // at the hint and the search stays linear overall
+        template <typename List, typename Id>
+        auto findEntity(List& list, Id id, size_t& hint) -> decltype(&list[0]) {
+            for (size_t a = 0; a < list.size(); a++) {
+                size_t b = (hint + a) % list.size();
+                if (list[b].a == id) {
+                    hint = b + 1;
+                    return &list[b];
+                }
+            }
+            return nullptr;
+        }
+
+        // Changes are judged on the quantized values, so jitter below the wire
+        // precision does not cost a send
+        uint32_t rocketChanges(const RocketState& a, const RocketState* b) {
+            if (!b) return 0xFF;
+            uint32_t c = 0;
+            if (!samePosition(a.b, b->b)) c |= ROCKET_POSITION;
+            if (!sameVelocity(a.c, b->c)) c |= ROCKET_VELOCITY;
+            if (quantizeAngle(a.d) != quantizeAngle(b->d)) c |= ROCKET_ROTATION;
+            if (quantizeClamped(a.e, ANGULAR_VELOCITY_SCALE, ANGULAR_VELOCITY_BITS) !=
+                quantizeClamped(b->e, ANGULAR_VELOCITY_SCALE, ANGULAR_VELOCITY_BITS)) c |= ROCKET_ANGULAR_VELOCITY;
+            if (quantizeThrust(a.f) != quantizeThrust(b->f)) c |= ROCKET_THRUST;
+            if (a.g != b->g) c |= ROCKET_MASS;
+            if (a.h != b->h) c |= ROCKET_COLOR;
+            if (a.j != b->j) c |= ROCKET_AUTHORITATIVE;
+            return c;
+        }
+
+        uint32_t planetChanges(const PlanetState& a, const PlanetState* b) {
+            if (!b) return PLANET_ALL;
+            uint32_t c = 0;
+            if (!samePosition(a.b, b->b)) c |= PLANET_POSITION;
+            if (!sameVelocity(a.c, b->c)) c |= PLANET_VELOCITY;
+            if (a.d != b->d) c |= PLANET_MASS;
+            if (a.f != b->f) c |= PLANET_COLOR;
+            if (a.g != b->g) c |= PLANET_OWNER;
+            return c;
+        }
+
+        // Sector-relative position. The sector is only written when it differs
+        // from the baseline's, which for anything in motion is rare.
+        void writePosition(BitWriter& w, sf::Vector2f pos, const sf::Vector2f* baselinePos) {
+            int64_t x = quantizePosition(pos.x);
+            int64_t y = quantizePosition(pos.y);
+            int32_t sx = sectorOf(x);
+            int32_t sy = sectorOf(y);
+
+            bool sameSector = baselinePos &&
+                sectorOf(quantizePosition(baselinePos->x)) == sx && sectorOf(quantizePosition(baselinePos->y)) == sy;
+            w.writeBool(!sameSector);
+            if (!sameSector) {
+                w.writeSigned(sx, SECTOR_INDEX_BITS);
+                w.writeSigned(sy, SECTOR_INDEX_BITS);
+            }
+            w.write(static_cast<uint32_t>(x - (static_cast<int64_t>(sx) << OFFSET_BITS)), OFFSET_BITS);
+            w.write(static_cast<uint32_t>(y - (static_cast<int64_t>(sy) << OFFSET_BITS)), OFFSET_BITS);
+        }
+
+        sf::Vector2f readPosition(BitReader& r, sf::Vector2f baselinePos) {
+            int32_t sx = sectorOf(quantizePosition(baselinePos.x));
+            int32_t sy = sectorOf(quantizePosition(baselinePos.y));
+            if (r.readBool()) {
+                sx = r.readSigned(SECTOR_INDEX_BITS);
+                sy = r.readSigned(SECTOR_INDEX_BITS);
+            }
+            int64_t x = (static_cast<int64_t>(sx) << OFFSET_BITS) + r.read(OFFSET_BITS);
+            int64_t y = (static_cast<int64_t>(sy) << OFFSET_BITS) + r.read(OFFSET_BITS);
+            return sf::Vector2f(static_cast<float>(static_cast<double>(x) / POSITION_SCALE),
+                static_cast<float>(static_cast<double>(y) / POSITION_SCALE));
+        }
+
+        void writeVelocity(BitWriter& w, sf::Vector2f v) {
+            w.writeSigned(quantizeClamped(v.x, VELOCITY_SCALE, VELOCITY_BITS), VELOCITY_BITS);
+            w.writeSigned(quantizeClamped(v.y, VELOCITY_SCALE, VELOCITY_BITS), VELOCITY_BITS);
+        }
+
+        sf::Vector2f readVelocity(BitReader& r) {
+            float x = static_cast<float>(r.readSigned(VELOCITY_BITS)) / VELOCITY_SCALE;
+            float y = static_cast<float>(r.readSigned(VELOCITY_BITS)) / VELOCITY_SCALE;
+            return sf::Vector2f(x, y);
+        }
+
+        void writeColor(BitWriter& w, sf::Color c) {
+            w.write(c.r, 8);
+            w.write(c.g, 8);
+            w.write(c.b, 8);
+            w.write(c.a, 8);
+        }
+
+        sf::Color readColor(BitReader& r) {
+            sf::Color c;
+            c.r = static_cast<uint8_t>(r.read(8));
+            c.g = static_cast<uint8_t>(r.read(8));
+            c.b = static_cast<uint8_t>(r.read(8));
+            c.a = static_cast<uint8_t>(r.read(8));
+            return c;
+        }
+
+        float radiusFromMass(float mass) {
+            return GameConstants::BASE_RADIUS_FACTOR * std::pow(mass / GameConstants::REFERENCE_MASS, 1.0f / 3.0f);
+        }
+
+        // Only touched from the network code, which runs on one thread
+        BitWriter& sharedWriter() { static BitWriter a; return a; }
+        BitReader& sharedReader() { static BitReader a; return a; }
+    }
+
+    bool write(sf::Packet& packet, const GameState& state, const GameState* baseline)
+    {
+        // Changed and removed counts never exceed these, and a wider count
+        // would be masked and misparse the rest of the payload
+        if (state.c.size() > MAX_ENTITIES || state.d.size() > MAX_ENTITIES ||
+            (baseline && (baseline->c.size() > MAX_ENTITIES || baseline->d.size() > MAX_ENTITIES))) {
+            std::cerr << "Game state too large to encode (" << state.c.size() << " rockets, "
+                << state.d.size() << " planets)" << std::endl;
+            return false;
+        }
+
+        BitWriter& w = sharedWriter();
+        w.clear();
+
+        w.write(static_cast<uint32_t>(state.a), 32);
+        w.writeBool(baseline != nullptr);
+        if (baseline) {
+            w.write(static_cast<uint32_t>(baseline->a), 32);
+        }
+        w.writeFloat(state.b);
+        w.writeBool(state.e);
+        w.write(state.f, 32);
+
+        size_t hint = 0;
+
+        // Rockets - changed ones only, then the ones that are gone
+        uint32_t changed = 0;
+        for (const auto& a : state.c) {
+            if (rocketChanges(a, baseline ? findEntity(baseline->c, a.a, hint) : nullptr)) changed++;
+        }
+        w.write(changed, COUNT_BITS);
+
+        hint = 0;
+        for (const auto& a : state.c) {
+            const RocketState* c = baseline ? findEntity(baseline->c, a.a, hint) : nullptr;
+            uint32_t b = rocketChanges(a, c);
+            if (!b) continue;
+
+            w.writeSigned(a.a, PLAYER_ID_BITS);
+            w.write(b, ROCKET_FIELD_BITS);
+            if (b & ROCKET_POSITION) writePosition(w, a.b, c ? &c->b : nullptr);
+            if (b & ROCKET_VELOCITY) writeVelocity(w, a.c);
+            if (b & ROCKET_ROTATION) w.write(quantizeAngle(a.d), ANGLE_BITS);
+            if (b & ROCKET_ANGULAR_VELOCITY) w.writeSigned(quantizeClamped(a.e, ANGULAR_VELOCITY_SCALE, ANGULAR_VELOCITY_BITS), ANGULAR_VELOCITY_BITS);
+            if (b & ROCKET_THRUST) w.write(quantizeThrust(a.f), THRUST_BITS);
+            if (b & ROCKET_MASS) w.writeFloat(a.g);
+            if (b & ROCKET_COLOR) writeColor(w, a.h);
+            if (b & ROCKET_AUTHORITATIVE) w.writeBool(a.j);
+        }
+
+        uint32_t removed = 0;
+        if (baseline) {
+            hint = 0;
+            for (const auto& a : baseline->c) {
+                if (!findEntity(state.c, a.a, hint)) removed++;
+            }
+        }
+        w.write(removed, COUNT_BITS);
+        if (removed) {
+            hint = 0;
+            for (const auto& a : baseline->c) {
+                if (!findEntity(state.c, a.a, hint)) w.writeSigned(a.a, PLAYER_ID_BITS);
+            }
+        }
+
+        // Planets - same layout
+        changed = 0;
+        hint = 0;
+        for (const auto& a : state.d) {
+            if (planetChanges(a, baseline ? findEntity(baseline->d, a.a, hint) : nullptr)) changed++;
+        }
+        w.write(changed, COUNT_BITS);
+
+        hint = 0;
+        for (const auto& a : state.d) {
+            const PlanetState* c = baseline ? findEntity(baseline->d, a.a, hint) : nullptr;
+            uint32_t b = planetChanges(a, c);
+            if (!b) continue;
+
+            w.write(a.a, 32);
+            w.write(b, PLANET_FIELD_BITS);
+            if (b & PLANET_POSITION) writePosition(w, a.b, c ? &c->b : nullptr);
+            if (b & PLANET_VELOCITY) writeVelocity(w, a.c);
+            if (b & PLANET_MASS) w.writeFloat(a.d);
+            if (b & PLANET_COLOR) writeColor(w, a.f);
+            if (b & PLANET_OWNER) w.writeSigned(a.g, OWNER_BITS);
+        }
+
+        removed = 0;
+        if (baseline) {
+            hint = 0;
+            for (const auto& a : baseline->d) {
+                if (!findEntity(state.d, a.a, hint)) removed++;
+            }
+        }
+        w.write(removed, COUNT_BITS);
+        if (removed) {
+            hint = 0;
+            for (const auto& a : baseline->d) {
+                if (!findEntity(state.d, a.a, hint)) w.write(a.a, 32);
+            }
+        }
+
+        packet << SCHEMA_VERSION;
+        w.writeTo(packet);
+        return true;
+    }
+
+    bool read(sf::Packet& packet, const SnapshotHistory& history, GameState& state)
+    {
+        uint8_t version;
+        if (!(packet >> version)) return false;
+        if (version != SCHEMA_VERSION) {
+            std::cerr << "Snapshot schema " << static_cast<int>(version) << " not supported (expected "
+                << static_cast<int>(SCHEMA_VERSION) << ")" << std::endl;
+            return false;
+        }
+
+        BitReader& r = sharedReader();
+        if (!r.readFrom(packet)) return false;
+
+        uint32_t sequence = r.read(32);
+        const GameState* baseline = nullptr;
+        if (r.readBool()) {
+            baseline = history.find(r.read(32));
+            if (!baseline) return false;
+        }
+
+        // Start from the baseline and patch it
+        if (baseline) {
+            state = *baseline;
+        }
+        else {
+            state.c.clear();
+            state.d.clear();
+        }
+        state.a = sequence;
+        state.b = r.readFloat();
+        state.e = r.readBool();
+        state.f = r.read(32);
+
+        uint32_t count = r.read(COUNT_BITS);
+        size_t hint = 0;
+        for (uint32_t a = 0; a < count && !r.hasFailed(); a++) {
+            int id = r.readSigned(PLAYER_ID_BITS);
+            uint32_t b = r.read(ROCKET_FIELD_BITS);
+
+            RocketState* c = findEntity(state.c, id, hint);
+            if (!c) {
+                // New rocket - the server sends every field
+                state.c.push_back(RocketState());
+                c = &state.c.back();
+                c->a = id;
+            }
+
+            if (b & ROCKET_POSITION) c->b = readPosition(r, c->b);
+            if (b & ROCKET_VELOCITY) c->c = readVelocity(r);
+            if (b & ROCKET_ROTATION) c->d = static_cast<float>(r.read(ANGLE_BITS)) * (360.0f / 65536.0f);
+            if (b & ROCKET_ANGULAR_VELOCITY) c->e = static_cast<float>(r.readSigned(ANGULAR_VELOCITY_BITS)) / ANGULAR_VELOCITY_SCALE;
+            if (b & ROCKET_THRUST) c->f = static_cast<float>(r.read(THRUST_BITS)) / 65535.0f;
+            if (b & ROCKET_MASS) c->g = r.readFloat();
+            if (b & ROCKET_COLOR) c->h = readColor(r);
+            if (b & ROCKET_AUTHORITATIVE) c->j = r.readBool();
+            c->i = state.b;
+        }
+
+        count = r.read(COUNT_BITS);
+        for (uint32_t a = 0; a < count && !r.hasFailed(); a++) {
+            int id = r.readSigned(PLAYER_ID_BITS);
+            for (size_t b = 0; b < state.c.size(); b++) {
+                if (state.c[b].a == id) {
+                    state.c.erase(state.c.begin() + b);
+                    break;
+                }
+            }
+        }
+
+        count = r.read(COUNT_BITS);
+        hint = 0;
+        for (uint32_t a = 0; a < count && !r.hasFailed(); a++) {
+            uint32_t id = r.read(32);
+            uint32_t b = r.read(PLANET_FIELD_BITS);
+
+            PlanetState* c = findEntity(state.d, id, hint);
+            if (!c) {
+                state.d.push_back(PlanetState());
+                c = &state.d.back();
+                c->a = id;
+            }
+
+            if (b & PLANET_POSITION) c->b = readPosition(r, c->b);
+            if (b & PLANET_VELOCITY) c->c = readVelocity(r);
+            if (b & PLANET_MASS) {
+                c->d = r.readFloat();
+                c->e = radiusFromMass(c->d);
+            }
+            if (b & PLANET_COLOR) c->f = readColor(r);
+            if (b & PLANET_OWNER) c->g = r.readSigned(OWNER_BITS);
+            c->h = state.b;
+        }
+
+        count = r.read(COUNT_BITS);
+        for (uint32_t a = 0; a < count && !r.hasFailed(); a++) {
+            uint32_t id = r.read(32);
+            for (size_t b = 0; b < state.d.size(); b++) {
+                if (state.d[b].a == id) {
+                    state.d.erase(state.d.begin() + b);
+                    break;
+                }
+            }
+        }
+
+        return !r.hasFailed();
+    }
+
+} // namespace SnapshotDelta
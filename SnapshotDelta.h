@@ -0,0 +1,61 @@
+// SnapshotDelta.h
+#pragma once
+#include "GameState.h"
+#include <SFML/Network.hpp>
+#include <vector>
+#include <cstddef>
+
+// Last few snapshots exchanged with one peer, indexed by sequence number.
+// The server keeps one per client with the states it sent, the client keeps
+// one with the states it reconstructed - both sides can then refer to any
+// recent sequence as a delta baseline.
+class SnapshotHistory {
+public:
+    static constexpr size_t SIZE = 32;
+
+private:
+    std::vector<GameState> a; // snapshots - slot = sequence % SIZE
+    std::vector<unsigned char> b; // used
+    unsigned long c; // ackedSequence - newest snapshot the peer confirmed
+    bool d; // hasAck
+
+public:
+    SnapshotHistory();
+
+    // Copies into the ring - slots keep their vector capacity between uses
+    void store(const GameState& state);
+    const GameState* find(unsigned long sequence) const;
+
+    void acknowledge(unsigned long sequence);
+    void resetAck() { d = false; }
+    // Baseline to encode the next snapshot against, nullptr for a full snapshot
+    const GameState* getBaseline() const { return d ? find(c) : nullptr; }
+    void clear();
+};
+
+// Delta encoding of GameState. Only the rockets and planets that changed since
+// the baseline are written, and of those only the fields that changed, each
+// flagged in a per-entity bit mask. Entities missing from the new state are
+// sent as removals. Per-entity timestamps are not sent - every changed entity
+// takes the snapshot timestamp, unchanged ones keep the baseline's.
+// Without a baseline every entity is written in full with the same format.
+//
+// The payload is bit-packed and quantized: positions are 1/32 unit fixed point
+// relative to a 1024 unit sector (the sector only goes out when it changes),
+// velocities 1/32 unit/s, rotation and thrust 16 bits. Planet radius is not
+// sent, it is derived from the mass. Reconstructed states hold the quantized
+// values, which is also what changes are judged against.
+namespace SnapshotDelta {
+    // Bumped whenever the wire layout changes - peers reject other versions
+    constexpr uint8_t SCHEMA_VERSION = 3;
+
+    // Returns false and writes nothing if the state (or baseline) lists more
+    // rockets or planets than a count field can carry (MAX_ENTITIES)
+    constexpr size_t MAX_ENTITIES = 0xFFFF;
+    bool write(sf::Packet& packet, const GameState& state, const GameState* baseline);
+
+    // Looks the packet's baseline up in history. Returns false on malformed
+    // input or when the baseline is no longer in the history - the receiver
+    // then needs a full snapshot.
+    bool read(sf::Packet& packet, const SnapshotHistory& history, GameState& state);
+}
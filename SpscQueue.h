@@ -0,0 +1,67 @@
+// SpscQueue.h
+#pragma once
+#include <atomic>
+#include <vector>
+#include <cstddef>
+#include <utility>
+
+// Bounded single-producer/single-consumer queue. One thread pushes and one
+// other thread pops, without locks: the head is only written by the consumer,
+// the tail only by the producer, and each publishes its slot with a release
+// store the other side reads with acquire. push() fails when the queue is full.
+template <typename T>
+class SpscQueue {
+private:
+    std::vector<T> a; // slots - capacity is a power of two
+    size_t b; // mask
+    alignas(64) std::atomic<size_t> c; // head - next slot to pop, written by the consumer
+    alignas(64) std::atomic<size_t> d; // tail - next slot to push, written by the producer
+
+public:
+    explicit SpscQueue(size_t capacity) : b(0), c(0), d(0) {
+        size_t e = 1;
+        while (e < capacity) {
+            e <<= 1;
+        }
+        a.resize(e);
+        b = e - 1;
+    }
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    // Producer only
+    bool push(T&& value) {
+        const size_t e = d.load(std::memory_order_relaxed);
+        if (e - c.load(std::memory_order_acquire) == a.size()) {
+            return false;
+        }
+        a[e & b] = std::move(value);
+        d.store(e + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Producer only
+    bool full() const {
+        return d.load(std::memory_order_relaxed) - c.load(std::memory_order_acquire) == a.size();
+    }
+
+    // Consumer only
+    bool pop(T& value) {
+        const size_t e = c.load(std::memory_order_relaxed);
+        if (e == d.load(std::memory_order_acquire)) {
+            return false;
+        }
+        value = std::move(a[e & b]);
+        c.store(e + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Only while neither thread is using the queue
+    void clear() {
+        T e;
+        while (pop(e)) {}
+    }
+
+    size_t capacity() const { return a.size(); }
+};
@@ -0,0 +1,222 @@
+// TrajectoryCache.cpp
+#include "TrajectoryCache.h"
+#include "Planet.h"
+#include "GameConstants.h"
+#include <cmath>
+#include <cstdint>
+
+TrajectoryCache::TrajectoryCache()
+    : b(sf::PrimitiveType::LineStrip), c(0.0f), d(0), e(0), f(true), g(false), h(0.0f),
+    i(std::make_shared<PathPredictor::Job>()), j(false), n(0.0f), q(0.0f), r(0.0f, 0.0f)
+{
+}
+
+TrajectoryCache::~TrajectoryCache()
+{
+    // The predictor may still hold the job - make sure it does not finish it
+    PathPredictor::getInstance().cancel(*i);
+}
+
+float TrajectoryCache::worldUnitsPerPixel(const sf::RenderWindow& window)
+{
+    const sf::View& a = window.getView();
+    float b = static_cast<float>(window.getSize().x) * a.getViewport().size.x;
+    return b > 0.0f ? a.getSize().x / b : 1.0f;
+}
+
+void TrajectoryCache::packPlanets(PackedBodies& out, const std::vector<Planet*>& planets, const Planet* ignore) const
+{
+    out.clear();
+    for (const auto& planet : planets) {
+        if (!planet || planet == ignore) continue;
+        sf::Vector2f p = planet->getPosition();
+        out.add(p.x, p.y, planet->getMass(), planet->getRadius());
+    }
+}
+
+void TrajectoryCache::requestPrediction(sf::Vector2f pos, sf::Vector2f vel, const std::vector<Planet*>& planets,
+    const Planet* ignore)
+{
+    // The worker only ever sees this snapshot, never the live planets
+    packPlanets(k.a, planets, ignore);
+    k.b = pos;
+    k.c = vel;
+    k.d = c;
+    k.e = d;
+    k.f = n;
+
+    PathPredictor::getInstance().submit(i, k);
+    r = sf::Vector2f(0.0f, 0.0f);
+    e = planets.size();
+    f = false;
+    j = true;
+}
+
+void TrajectoryCache::collectPrediction()
+{
+    if (!j || !PathPredictor::getInstance().collect(*i, l)) return;
+
+    // The worker predicted in the coordinates of the request
+    a.clear();
+    for (size_t b = 0; b < l.a.size(); b++) {
+        a.push_back({ l.a[b] - r, l.b[b], l.c[b] });
+    }
+    r = sf::Vector2f(0.0f, 0.0f);
+    g = l.d;
+    h = 0.0f;
+    q = l.e;
+    o = p;
+    j = false;
+}
+
+void TrajectoryCache::shiftOrigin(sf::Vector2f offset)
+{
+    for (auto& b : a) {
+        b.a -= offset;
+    }
+    o -= offset;
+    p -= offset;
+    if (j) {
+        r += offset;
+    }
+}
+
+void TrajectoryCache::extend(const std::vector<Planet*>& planets, const Planet* ignore)
+{
+    // A closed orbit never runs out - advanceHead() moves passed samples to the tail
+    if (a.empty() || g || q > 0.0f) return;
+
+    const float horizon = c * static_cast<float>(d);
+    if (static_cast<int>(a.size()) >= d || a.back().c - h >= horizon) return;
+
+    packPlanets(m, planets, ignore);
+
+    PathPredictor::State state;
+    state.a = a.back().a;
+    state.b = a.back().b;
+    state.c = a.back().c;
+    state.d = a.size() > 1 ? a.back().c - a[a.size() - 2].c : c;
+
+    const float maxStep = c * GameConstants::TRAJECTORY_MAX_STEP_SCALE;
+    while (static_cast<int>(a.size()) < d && state.c - h < horizon) {
+        if (!PathPredictor::advance(m, state, n, maxStep)) {
+            g = true;
+            break;
+        }
+        a.push_back({ state.a, state.b, state.c });
+    }
+}
+
+bool TrajectoryCache::advanceHead(sf::Vector2f pos)
+{
+    // Drop every sample the body has already moved past. Recycled samples come
+    // back around, so never look at more than one lap of them.
+    for (size_t count = a.size(); count > 0 && !a.empty(); count--) {
+        sf::Vector2f offset = pos - a.front().a;
+        if (offset.x * a.front().b.x + offset.y * a.front().b.y <= 0.0f) break;
+        Sample b = a.front();
+        o = b.a;
+        h = b.c;
+        a.pop_front();
+
+        if (q > 0.0f) {
+            b.c += q;
+            a.push_back(b);
+        }
+    }
+
+    if (a.empty()) return false;
+
+    // The body should now sit on the segment leading to the head sample,
+    // otherwise something outside gravity moved it
+    sf::Vector2f segment = a.front().a - o;
+    float limit = std::sqrt(segment.x * segment.x + segment.y * segment.y) + GameConstants::TRAJECTORY_CACHE_TOLERANCE;
+    sf::Vector2f offset = a.front().a - pos;
+    return offset.x * offset.x + offset.y * offset.y <= limit * limit;
+}
+
+void TrajectoryCache::buildVertices(sf::Vector2f pos, sf::Color color, bool detectSelfIntersection)
+{
+    b.clear();
+
+    // Add the starting point
+    sf::Vertex startPoint;
+    startPoint.position = pos;
+    startPoint.color = sf::Color(color.r, color.g, color.b, 100); // Semi-transparent
+    b.append(startPoint);
+
+    const float horizon = c * static_cast<float>(d);
+
+    for (size_t step = 0; step < a.size(); step++) {
+        // Calculate fade-out effect over the prediction horizon
+        float fade = horizon > 0.0f ? (a[step].c - h) / horizon : 0.0f;
+        float alpha = 255 * (1.0f - std::min(std::max(fade, 0.0f), 1.0f));
+
+        sf::Vertex point;
+        point.position = a[step].a;
+        point.color = sf::Color(color.r, color.g, color.b, static_cast<uint8_t>(alpha));
+        b.append(point);
+
+        // Check for self-intersection if requested
+        if (detectSelfIntersection && step > 10) {
+            // Simple implementation: just check against starting point
+            sf::Vector2f toStart = a[step].a - pos;
+            if (toStart.x * toStart.x + toStart.y * toStart.y < GameConstants::ROCKET_SIZE * GameConstants::ROCKET_SIZE) {
+                // Add a special marker at intersection point
+                sf::Vertex marker;
+                marker.position = a[step].a;
+                marker.color = sf::Color::Yellow;
+                b.append(marker);
+                break;
+            }
+        }
+    }
+}
+
+const sf::VertexArray& TrajectoryCache::update(sf::Vector2f pos, sf::Vector2f vel, const std::vector<Planet*>& planets,
+    float timeStep, int steps, float tolerance, sf::Color color, bool detectSelfIntersection, const Planet* ignore)
+{
+    if (timeStep != c || steps != d || planets.size() != e) {
+        f = true;
+    }
+
+    // Zooming in far enough makes the old point spacing visible
+    if (tolerance < n * 0.5f || tolerance > n * 4.0f) {
+        f = true;
+    }
+
+    c = timeStep;
+    d = steps;
+
+    // Pick up a finished background prediction
+    collectPrediction();
+
+    // Trim what the body has flown past, even while a new prediction is on its way
+    bool a = advanceHead(pos);
+
+    if (!j) {
+        // Off the predicted path - unless the path simply ended on a planet
+        if (!a && !(this->a.empty() && g)) {
+            f = true;
+        }
+
+        // The prediction assumes the planets stay where they were when it was
+        // made, so it is refreshed once enough of it has been consumed
+        if (h > GameConstants::TRAJECTORY_CACHE_MAX_AGE) {
+            f = true;
+        }
+    }
+
+    if (f) {
+        n = tolerance;
+        p = pos;
+        requestPrediction(pos, vel, planets, ignore);
+    }
+    else if (!j) {
+        // Still on the predicted path - top the tail back up to the full horizon
+        extend(planets, ignore);
+    }
+
+    buildVertices(pos, color, detectSelfIntersection);
+    return b;
+}
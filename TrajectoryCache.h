@@ -0,0 +1,77 @@
+// TrajectoryCache.h
+#pragma once
+#include <SFML/Graphics.hpp>
+#include "PathPredictor.h"
+#include <deque>
+#include <vector>
+#include <memory>
+
+class Planet;
+
+// Incrementally maintained path prediction for a coasting body.
+// Full predictions run on the PathPredictor thread; until one finishes the
+// previous path keeps being drawn. Samples are kept between frames: the ones
+// the body has already flown past are dropped from the head and the tail is
+// extended back to the full horizon, so a frame normally integrates a handful
+// of steps instead of the whole path. Anything the prediction cannot see
+// coming (thrust, a teleport, planets being added or removed) must call
+// invalidate() to request a fresh prediction.
+class TrajectoryCache {
+private:
+    struct Sample {
+        sf::Vector2f a; // position
+        sf::Vector2f b; // velocity
+        float c; // time - since the start of the prediction
+    };
+
+    std::deque<Sample> a; // samples - a[0] is the next predicted point ahead of the body
+    sf::VertexArray b; // vertices - rebuilt in place every frame, capacity is kept
+    float c; // timeStep
+    int d; // steps
+    size_t e; // planetCount
+    bool f; // dirty - a fresh prediction has to be requested
+    bool g; // hitObject - the tail ends on a planet, nothing left to extend
+    float h; // age - prediction time consumed since the current path was predicted
+    std::shared_ptr<PathPredictor::Job> i; // job - shared with the predictor thread
+    bool j; // pending - a prediction is running in the background
+    PathPredictor::Request k; // request - reused snapshot buffer
+    PathPredictor::Result l; // result - reused buffer for finished predictions
+    PackedBodies m; // planets - live planets packed for extending the tail
+    float n; // tolerance - world-space error the current path was predicted with
+    sf::Vector2f o; // lastPassed - most recent sample the body flew past
+    sf::Vector2f p; // predictionStart - where the body was when the pending prediction was requested
+    float q; // period - closed conic orbits recycle passed samples onto the tail, 0 otherwise
+    sf::Vector2f r; // originShift - origin moved this far while the pending prediction was running
+
+    void requestPrediction(sf::Vector2f pos, sf::Vector2f vel, const std::vector<Planet*>& planets, const Planet* ignore);
+    void collectPrediction();
+    void packPlanets(PackedBodies& out, const std::vector<Planet*>& planets, const Planet* ignore) const;
+    void extend(const std::vector<Planet*>& planets, const Planet* ignore);
+    bool advanceHead(sf::Vector2f pos);
+    void buildVertices(sf::Vector2f pos, sf::Color color, bool detectSelfIntersection);
+
+public:
+    TrajectoryCache();
+    ~TrajectoryCache();
+
+    TrajectoryCache(const TrajectoryCache&) = delete;
+    TrajectoryCache& operator=(const TrajectoryCache&) = delete;
+
+    void invalidate() { f = true; }
+    // Floating origin - moves the cached path (and any prediction still running) by -offset
+    void shiftOrigin(sf::Vector2f offset);
+    bool isPending() const { return j; }
+    size_t getSampleCount() const { return a.size(); }
+
+    // Brings the prediction up to date for a body now at pos/vel and returns the
+    // polyline to draw. The path covers timeStep * steps seconds with at most
+    // steps points, spaced adaptively so it stays within tolerance world units
+    // of the true path. ignore is left out of the planets (a planet's own orbit).
+    // The reference stays valid until the next call.
+    const sf::VertexArray& update(sf::Vector2f pos, sf::Vector2f vel, const std::vector<Planet*>& planets,
+        float timeStep, int steps, float tolerance, sf::Color color, bool detectSelfIntersection,
+        const Planet* ignore = nullptr);
+
+    // World units covered by one pixel of the window's current view
+    static float worldUnitsPerPixel(const sf::RenderWindow& window);
+};
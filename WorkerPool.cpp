@@ -0,0 +1,115 @@
+// WorkerPool.cpp
+#include "WorkerPool.h"
+#include <algorithm>
+
+WorkerPool::WorkerPool(size_t threadCount)
+    : e(nullptr), f(0), g(0), h(0), i(false), j(1)
+{
+    setThreadCount(threadCount);
+}
+
+WorkerPool::~WorkerPool()
+{
+    stopWorkers();
+}
+
+void WorkerPool::setThreadCount(size_t threadCount)
+{
+    if (threadCount == 0) {
+        threadCount = std::max<size_t>(1, std::thread::hardware_concurrency());
+    }
+    if (threadCount == j) return;
+
+    // Running workers split ranges by the old count - the next parallelFor starts new ones
+    stopWorkers();
+    j = threadCount;
+}
+
+void WorkerPool::startWorkers()
+{
+    i = false;
+    for (size_t a = 1; a < j; a++) {
+        // Pass the current generation so a new worker never runs a stale job
+        this->a.emplace_back(&WorkerPool::workerLoop, this, a, g);
+    }
+}
+
+void WorkerPool::stopWorkers()
+{
+    {
+        std::lock_guard<std::mutex> a(b);
+        i = true;
+    }
+    c.notify_all();
+
+    for (auto& a : this->a) {
+        if (a.joinable()) {
+            a.join();
+        }
+    }
+    a.clear();
+}
+
+void WorkerPool::runRange(size_t threadIndex, size_t threadCount)
+{
+    // Contiguous, evenly sized ranges keep each thread on its own cache lines
+    size_t a = f * threadIndex / threadCount;
+    size_t b = f * (threadIndex + 1) / threadCount;
+    if (a < b) {
+        (*e)(a, b, threadIndex);
+    }
+}
+
+void WorkerPool::workerLoop(size_t threadIndex, size_t generation)
+{
+    size_t a = generation; // last job generation this worker ran
+
+    while (true) {
+        {
+            std::unique_lock<std::mutex> b(this->b);
+            c.wait(b, [&] { return i || g != a; });
+            if (i) return;
+            a = g;
+        }
+
+        runRange(threadIndex, getThreadCount());
+
+        {
+            std::lock_guard<std::mutex> b(this->b);
+            if (--h == 0) {
+                d.notify_one();
+            }
+        }
+    }
+}
+
+void WorkerPool::parallelFor(size_t count, const RangeFunction& fn)
+{
+    if (count == 0) return;
+
+    // Single-threaded pool (or nothing worth splitting) - run inline
+    if (j < 2 || count < j) {
+        fn(0, count, 0);
+        return;
+    }
+
+    if (this->a.empty()) {
+        startWorkers();
+    }
+
+    {
+        std::lock_guard<std::mutex> a(b);
+        e = &fn;
+        f = count;
+        h = this->a.size();
+        g++;
+    }
+    c.notify_all();
+
+    // The calling thread takes the first range instead of idling
+    runRange(0, getThreadCount());
+
+    std::unique_lock<std::mutex> a(b);
+    d.wait(a, [&] { return h == 0; });
+    e = nullptr;
+}
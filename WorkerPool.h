@@ -0,0 +1,51 @@
+// WorkerPool.h
+#pragma once
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <cstddef>
+
+// Persistent pool of worker threads for data-parallel loops.
+// parallelFor() splits [0, count) into one contiguous range per thread, runs
+// the ranges concurrently (the calling thread takes the first one) and returns
+// when all of them are done. The workers are only started by the first call
+// that splits work, so a pool whose loops always stay small costs no threads.
+// After that they sleep between calls and are never re-created, so calling
+// this every tick is cheap.
+class WorkerPool {
+public:
+    // fn(begin, end, threadIndex) - threadIndex is in [0, getThreadCount())
+    using RangeFunction = std::function<void(size_t, size_t, size_t)>;
+
+private:
+    std::vector<std::thread> a; // workers
+    std::mutex b; // mutex
+    std::condition_variable c; // workReady
+    std::condition_variable d; // workDone
+    const RangeFunction* e; // currentJob
+    size_t f; // jobCount
+    size_t g; // jobGeneration - bumped for every parallelFor call
+    size_t h; // pendingWorkers - workers still running the current job
+    bool i; // stopping
+    size_t j; // threadCount - including the caller, workers may not be started yet
+
+    void workerLoop(size_t threadIndex, size_t generation);
+    void runRange(size_t threadIndex, size_t threadCount);
+    void startWorkers();
+    void stopWorkers();
+
+public:
+    // threadCount includes the calling thread; 0 picks the hardware thread count
+    explicit WorkerPool(size_t threadCount = 1);
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    void setThreadCount(size_t threadCount);
+    size_t getThreadCount() const { return j; }
+
+    void parallelFor(size_t count, const RangeFunction& fn);
+};